@@ -19,6 +19,9 @@
 // Qt headers
 #include <QFuture>
 
+// std headers
+#include <algorithm>
+
 // Maps SDK headers
 #include <Attachment.h>
 #include <AttachmentsPopupElement.h>
@@ -41,29 +44,120 @@ namespace Esri::ArcGISRuntime::Toolkit
                                                                                PopupViewController* popupViewController,
                                                                                QObject* parent) :
     PopupElementViewItem{attachmentsPopupElement, parent},
-    m_popupAttachmentItems{new GenericListModel(&PopupAttachmentItem::staticMetaObject, this)}
+    m_popupAttachmentItems{new GenericListModel(&PopupAttachmentItem::staticMetaObject, this)},
+    m_popupViewController{popupViewController}
+  {
+    fetchPopupAttachmentItems();
+  }
+
+  AttachmentsPopupElementViewController::~AttachmentsPopupElementViewController() = default;
+
+  /*!
+    \internal
+    Rebinds this controller to \a popupElement, recycling the attachment items already created.
+
+    The rows of the previous element are removed straight away, as its attachments may be deleted
+    along with its popup before those of \a popupElement have been fetched.
+   */
+  void AttachmentsPopupElementViewController::setPopupElement(PopupElement* popupElement)
   {
-    attachmentsPopupElement->fetchAttachmentsAsync().then(this, [this, popupViewController]()
+    if (popupElement == this->popupElement())
     {
-      for (auto* popupAttachment : static_cast<AttachmentsPopupElement*>(popupElement())->attachments())
+      return;
+    }
+
+    recyclePopupAttachmentItems();
+    PopupElementViewItem::setPopupElement(popupElement);
+    emit attachmentPopupElementChanged();
+    fetchPopupAttachmentItems();
+  }
+
+  void AttachmentsPopupElementViewController::fetchPopupAttachmentItems()
+  {
+    auto* attachmentsPopupElement = static_cast<AttachmentsPopupElement*>(popupElement());
+    if (!attachmentsPopupElement)
+    {
+      return;
+    }
+
+    // attachments already fetched, for example by the popup prefetcher, are shown without waiting
+    if (!attachmentsPopupElement->attachments().isEmpty())
+    {
+      updatePopupAttachmentItems();
+      return;
+    }
+
+    attachmentsPopupElement->fetchAttachmentsAsync().then(this, [this, attachmentsPopupElement]()
+    {
+      // this controller has been rebound to another element since the fetch started
+      if (popupElement() != attachmentsPopupElement)
       {
-        m_popupAttachmentItems->append(new PopupAttachmentItem(popupAttachment, popupViewController, this));
+        return;
       }
-      emit attachmentPopupElementChanged();
+
+      updatePopupAttachmentItems();
     });
   }
 
-  AttachmentsPopupElementViewController::~AttachmentsPopupElementViewController() = default;
+  void AttachmentsPopupElementViewController::updatePopupAttachmentItems()
+  {
+    recyclePopupAttachmentItems();
+
+    const auto attachments = static_cast<AttachmentsPopupElement*>(popupElement())->attachments();
+    QList<QObject*> items;
+    items.reserve(attachments.size());
+    for (auto* attachment : attachments)
+    {
+      if (m_recycledPopupAttachmentItems.isEmpty())
+      {
+        // owned by this controller rather than the model, so removing their rows does not delete them
+        items.append(new PopupAttachmentItem(attachment, m_popupViewController, this));
+      }
+      else
+      {
+        auto* item = m_recycledPopupAttachmentItems.takeLast();
+        item->setPopupAttachment(attachment);
+        items.append(item);
+      }
+    }
+
+    if (!items.isEmpty())
+    {
+      m_popupAttachmentItems->append(items);
+    }
+
+    emit attachmentPopupElementChanged();
+  }
+
+  void AttachmentsPopupElementViewController::recyclePopupAttachmentItems()
+  {
+    const auto rowCount = m_popupAttachmentItems->rowCount();
+    for (int i = 0; i < rowCount; ++i)
+    {
+      if (auto* item = m_popupAttachmentItems->element<PopupAttachmentItem>(m_popupAttachmentItems->index(i)))
+      {
+        item->setPopupAttachment(nullptr);
+        m_recycledPopupAttachmentItems.append(item);
+      }
+    }
+
+    if (rowCount > 0)
+    {
+      m_popupAttachmentItems->removeRows(0, rowCount);
+    }
+  }
 
   QString AttachmentsPopupElementViewController::title() const
   {
-    const auto title = static_cast<AttachmentsPopupElement*>(popupElement())->title();
+    auto* attachmentsPopupElement = static_cast<AttachmentsPopupElement*>(popupElement());
+    const auto title = attachmentsPopupElement ? attachmentsPopupElement->title() : QString{};
     return !title.isEmpty() ? title : QStringLiteral("Attachments");
   }
 
   QString AttachmentsPopupElementViewController::description() const
   {
-    return static_cast<AttachmentsPopupElement*>(popupElement())->description();
+    auto* attachmentsPopupElement = static_cast<AttachmentsPopupElement*>(popupElement());
+    return attachmentsPopupElement ? attachmentsPopupElement->description() : QString{};
   }
 
   GenericListModel* AttachmentsPopupElementViewController::popupAttachmentItems() const
@@ -17,6 +17,7 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_ATTACHMENTSPOPUPELEMENTVIEWCONTROLLER_H
 
 // Qt headers
+#include <QList>
 #include <QObject>
 
 // Other headers
@@ -31,6 +32,7 @@ namespace Esri::ArcGISRuntime
   namespace Toolkit
   {
 
+    class PopupAttachmentItem;
     class PopupViewController;
 
     class AttachmentsPopupElementViewController : public PopupElementViewItem
@@ -46,16 +48,24 @@ namespace Esri::ArcGISRuntime
                                                      QObject* parent = nullptr);
       ~AttachmentsPopupElementViewController() override;
 
+      void setPopupElement(PopupElement* popupElement) override;
+
     private:
       QString title() const;
       QString description() const;
       GenericListModel* popupAttachmentItems() const;
+      void fetchPopupAttachmentItems();
+      void updatePopupAttachmentItems();
+      void recyclePopupAttachmentItems();
 
     signals:
       void attachmentPopupElementChanged();
 
     private:
       GenericListModel* m_popupAttachmentItems = nullptr;
+      PopupViewController* m_popupViewController = nullptr;
+      // unbound items kept out of the model, to be rebound to the attachments of the next element
+      QList<PopupAttachmentItem*> m_recycledPopupAttachmentItems;
     };
 
   } // namespace Toolkit
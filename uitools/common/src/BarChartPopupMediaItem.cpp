@@ -38,28 +38,52 @@ namespace Esri::ArcGISRuntime::Toolkit
   BarChartPopupMediaItem::BarChartPopupMediaItem(PopupMedia* popupMedia, QObject* parent) :
     PopupMediaItem{popupMedia, parent}
   {
+    updateValues();
   }
 
   BarChartPopupMediaItem::~BarChartPopupMediaItem() = default;
 
-  QVariantList BarChartPopupMediaItem::barSetLabels() const
+  void BarChartPopupMediaItem::setPopupMedia(PopupMedia* popupMedia)
   {
-    return m_barSetLabels;
+    if (popupMedia == popupMediaItem())
+    {
+      return;
+    }
+
+    PopupMediaItem::setPopupMedia(popupMedia);
+    updateValues();
+    emit barChartPopupMediaItemChanged();
   }
 
-  QVariantList BarChartPopupMediaItem::barSets()
+  void BarChartPopupMediaItem::updateValues()
   {
-    QVariantList barSets;
+    m_maxValue = 0.0;
+    m_minValue = 0.0;
+    m_barSetLabels.clear();
+    m_values.clear();
+    m_colors.clear();
+
+    if (!popupMediaItem())
+    {
+      // unbound while pooled
+      return;
+    }
+
+    // the media value is read once, the lists it returns are copies
     auto* mediaValue = popupMediaItem()->value();
-    const auto popupMediaValueDataLength = mediaValue->data().length();
+    const auto data = mediaValue->data();
+    const auto labels = mediaValue->labels();
     const auto chartColors = mediaValue->chartColors();
+    const auto popupMediaValueDataLength = data.length();
     const auto colorsHasLessThanLabels = chartColors.size() < popupMediaValueDataLength;
 
+    m_barSetLabels.reserve(popupMediaValueDataLength);
+    m_values.reserve(popupMediaValueDataLength);
     for (int i = 0; i < popupMediaValueDataLength; i++)
     {
-      const auto label = mediaValue->labels().at(i);
-      const auto value = mediaValue->data().at(i).toReal();
-      m_barSetLabels.append(label);
+      const auto value = data.at(i).toReal();
+      m_barSetLabels.append(labels.at(i));
+      m_values.append(value);
 
       if (value >= m_maxValue)
       {
@@ -70,19 +94,44 @@ namespace Esri::ArcGISRuntime::Toolkit
       {
         m_minValue = value;
       }
+    }
+
+    if (!chartColors.isEmpty() && !colorsHasLessThanLabels)
+    {
+      m_colors = chartColors.mid(0, popupMediaValueDataLength);
+    }
+  }
+
+  QVariantList BarChartPopupMediaItem::barSetLabels() const
+  {
+    return m_barSetLabels;
+  }
 
-      const auto barset = new QBarSet(label);
-      barset->append(value);
+  /*!
+    \internal
+    Returns a new QBarSet for each value, built from the values computed when this item was bound to its media.
 
-      if (!chartColors.isEmpty() && !colorsHasLessThanLabels)
+    The sets are unparented because the BarSeries they are appended to takes ownership of them, and a set
+    can only belong to one series, so every chart showing this item needs its own.
+   */
+  QVariantList BarChartPopupMediaItem::barSets() const
+  {
+    QVariantList barSets;
+    barSets.reserve(m_values.size());
+
+    for (int i = 0; i < m_values.size(); i++)
+    {
+      const auto barset = new QBarSet(m_barSetLabels.at(i).toString());
+      barset->append(m_values.at(i));
+
+      if (!m_colors.isEmpty())
       {
-        const auto color = chartColors.at(i);
+        const auto color = m_colors.at(i);
         barset->setColor(color);
         barset->setBorderColor(color);
       }
       barSets.append(QVariant::fromValue(barset));
     }
-    emit barChartPopupMediaItemChanged();
     return barSets;
   }
 
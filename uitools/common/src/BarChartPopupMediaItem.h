@@ -17,7 +17,9 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_BARCHARTPOPUPMEDIAITEM_H
 
 // Qt headers
+#include <QColor>
 #include <QJsonArray>
+#include <QList>
 #include <QObject>
 #include <QVariant>
 
@@ -41,11 +43,14 @@ namespace Esri::ArcGISRuntime::Toolkit
     explicit BarChartPopupMediaItem(PopupMedia* popupMedia, QObject* parent = nullptr);
     ~BarChartPopupMediaItem() override;
 
+    void setPopupMedia(PopupMedia* popupMedia) override;
+
   private:
-    QVariantList barSets();
+    QVariantList barSets() const;
     QVariantList barSetLabels() const;
     qreal maxValue() const;
     qreal minValue() const;
+    void updateValues();
 
   signals:
     void barChartPopupMediaItemChanged();
@@ -54,6 +59,9 @@ namespace Esri::ArcGISRuntime::Toolkit
     qreal m_maxValue = 0.0;
     qreal m_minValue = 0.0;
     QVariantList m_barSetLabels;
+    QList<qreal> m_values;
+    // empty unless there is a color for every value
+    QList<QColor> m_colors;
   };
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "BasemapGalleryCatalogCache.h"
+
+// ArcGISRuntime headers
+#include <Portal.h>
+
+// Qt headers
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QVariant>
+
+// std headers
+#include <algorithm>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    // bump when the layout of the file changes, files of other versions are ignored
+    constexpr int fileVersion = 1;
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::BasemapGalleryCatalogCache
+    \brief Remembers the basemaps fetched from each portal across application runs.
+
+    Catalogs are keyed by the portal URL and whether they hold 3D basemaps, and persisted
+    to a JSON file so the gallery can list basemaps before the portal has been fetched.
+    The basemaps most recently applied from each catalog are remembered alongside it.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  BasemapGalleryCatalogCache::BasemapGalleryCatalogCache(const QString& filePath) :
+    m_filePath(filePath)
+  {
+  }
+
+  /*!
+    \brief Returns the file in the application's cache directory catalogs are persisted to.
+   */
+  QString BasemapGalleryCatalogCache::defaultFilePath()
+  {
+    return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+      .filePath(QStringLiteral("BasemapGallery/catalog.json"));
+  }
+
+  /*!
+    \brief Returns the cache key of the 2D, or if \a is3D the 3D, basemaps of \a portal.
+   */
+  QString BasemapGalleryCatalogCache::key(Portal* portal, bool is3D)
+  {
+    if (!portal)
+    {
+      return {};
+    }
+
+    return portal->url().toString() + (is3D ? QStringLiteral("|3D") : QStringLiteral("|2D"));
+  }
+
+  /*!
+    \brief Returns the entries last stored under \a key, in gallery order.
+
+    The persisted file is read the first time this is called.
+   */
+  QList<BasemapGalleryCatalogCache::Entry> BasemapGalleryCatalogCache::find(const QString& key)
+  {
+    if (!m_isLoaded)
+    {
+      load();
+    }
+
+    return m_catalogs.value(key);
+  }
+
+  /*!
+    \brief Stores \a entries under \a key, writing the file only if they differ from those already stored.
+   */
+  void BasemapGalleryCatalogCache::insert(const QString& key, const QList<Entry>& entries)
+  {
+    if (key.isEmpty())
+    {
+      return;
+    }
+
+    if (!m_isLoaded)
+    {
+      load();
+    }
+
+    const auto it = m_catalogs.constFind(key);
+    if (it != m_catalogs.cend() &&
+        std::equal(it->cbegin(), it->cend(), entries.cbegin(), entries.cend(), [](const auto& a, const auto& b)
+    {
+      return a.itemId == b.itemId && a.title == b.title && a.is3D == b.is3D;
+    }))
+    {
+      return;
+    }
+
+    m_catalogs.insert(key, entries);
+    save();
+  }
+
+  /*!
+    \brief Returns the item ids of the basemaps last applied from the catalog stored under \a key, most recent first.
+   */
+  QStringList BasemapGalleryCatalogCache::recentItemIds(const QString& key)
+  {
+    if (!m_isLoaded)
+    {
+      load();
+    }
+
+    return m_recentItemIds.value(key);
+  }
+
+  /*!
+    \brief Makes \a itemId the most recently applied basemap of the catalog stored under \a key,
+    remembering at most \a maximumCount of them.
+   */
+  void BasemapGalleryCatalogCache::touchRecentItemId(const QString& key, const QString& itemId, int maximumCount)
+  {
+    if (key.isEmpty() || itemId.isEmpty())
+    {
+      return;
+    }
+
+    if (!m_isLoaded)
+    {
+      load();
+    }
+
+    auto& itemIds = m_recentItemIds[key];
+    if (!itemIds.isEmpty() && itemIds.first() == itemId)
+    {
+      return;
+    }
+
+    itemIds.removeAll(itemId);
+    itemIds.prepend(itemId);
+    if (itemIds.size() > maximumCount)
+    {
+      itemIds.resize(std::max(maximumCount, 0));
+    }
+    save();
+  }
+
+  void BasemapGalleryCatalogCache::load()
+  {
+    m_isLoaded = true;
+
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+      return;
+    }
+
+    const auto document = QJsonDocument::fromJson(file.readAll());
+    const auto root = document.object();
+    if (root.value(QStringLiteral("version")).toInt() != fileVersion)
+    {
+      return;
+    }
+
+    const auto catalogs = root.value(QStringLiteral("catalogs")).toObject();
+    for (auto catalog = catalogs.begin(); catalog != catalogs.end(); ++catalog)
+    {
+      QList<Entry> entries;
+      const auto array = catalog.value().toArray();
+      for (const auto& value : array)
+      {
+        const auto object = value.toObject();
+        const auto itemId = object.value(QStringLiteral("itemId")).toString();
+        if (itemId.isEmpty())
+        {
+          continue;
+        }
+
+        entries.append({itemId,
+                        object.value(QStringLiteral("title")).toString(),
+                        object.value(QStringLiteral("is3D")).toBool()});
+      }
+      m_catalogs.insert(catalog.key(), entries);
+    }
+
+    const auto recent = root.value(QStringLiteral("recent")).toObject();
+    for (auto it = recent.begin(); it != recent.end(); ++it)
+    {
+      m_recentItemIds.insert(it.key(), it.value().toVariant().toStringList());
+    }
+  }
+
+  void BasemapGalleryCatalogCache::save() const
+  {
+    if (m_filePath.isEmpty())
+    {
+      return;
+    }
+
+    QJsonObject catalogs;
+    for (auto it = m_catalogs.cbegin(); it != m_catalogs.cend(); ++it)
+    {
+      QJsonArray array;
+      for (const auto& entry : it.value())
+      {
+        array.append(QJsonObject{{QStringLiteral("itemId"), entry.itemId},
+                                 {QStringLiteral("title"), entry.title},
+                                 {QStringLiteral("is3D"), entry.is3D}});
+      }
+      catalogs.insert(it.key(), array);
+    }
+
+    QJsonObject recent;
+    for (auto it = m_recentItemIds.cbegin(); it != m_recentItemIds.cend(); ++it)
+    {
+      recent.insert(it.key(), QJsonArray::fromStringList(it.value()));
+    }
+
+    const QJsonObject root{{QStringLiteral("version"), fileVersion},
+                           {QStringLiteral("catalogs"), catalogs},
+                           {QStringLiteral("recent"), recent}};
+
+    QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+
+    // written to a temporary file first, so a crash never leaves a truncated cache behind
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) < 0 || !file.commit())
+    {
+      qDebug() << "Could not save the basemap catalog to" << m_filePath << file.errorString();
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
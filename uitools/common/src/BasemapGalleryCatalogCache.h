@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_BASEMAPGALLERYCATALOGCACHE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_BASEMAPGALLERYCATALOGCACHE_H
+
+// Qt headers
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+namespace Esri::ArcGISRuntime
+{
+  class Portal;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class BasemapGalleryCatalogCache
+  {
+  public:
+    // What the gallery needs to list a portal basemap before it has been fetched.
+    struct Entry
+    {
+      // also the key of the basemap's thumbnail in BasemapGalleryThumbnailCache
+      QString itemId;
+      QString title;
+      bool is3D = false;
+    };
+
+    explicit BasemapGalleryCatalogCache(const QString& filePath = defaultFilePath());
+
+    static QString defaultFilePath();
+
+    static QString key(Portal* portal, bool is3D);
+
+    QList<Entry> find(const QString& key);
+
+    void insert(const QString& key, const QList<Entry>& entries);
+
+    QStringList recentItemIds(const QString& key);
+
+    void touchRecentItemId(const QString& key, const QString& itemId, int maximumCount);
+
+  private:
+    void load();
+    void save() const;
+
+    QString m_filePath;
+    QHash<QString, QList<Entry>> m_catalogs;
+    // most recently applied first
+    QHash<QString, QStringList> m_recentItemIds;
+    bool m_isLoaded = false;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_BASEMAPGALLERYCATALOGCACHE_H
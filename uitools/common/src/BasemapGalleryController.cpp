@@ -33,6 +33,7 @@
 #include <LayerListModel.h>
 #include <Loadable.h>
 #include <Map.h>
+#include <PortalItem.h>
 #include <Scene.h>
 #include <SceneViewTypes.h>
 #include <SpatialReference.h>
@@ -42,6 +43,9 @@
 #include <QPersistentModelIndex>
 #include <QPointer>
 
+// std headers
+#include <utility>
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
@@ -141,14 +145,58 @@ namespace Esri::ArcGISRuntime::Toolkit
       }
     }
 
+    /*!
+      \internal
+      Returns the spatial reference basemaps must match to be applied to \a geoModel,
+      taking the tiling scheme of global scenes into account.
+     */
+    SpatialReference effectiveSpatialReference(GeoModel* geoModel)
+    {
+      if (auto* scene = qobject_cast<Scene*>(geoModel))
+      {
+        // Local Scenes use SceneViewTilingScheme::Automatic, so won't engage with this logic
+        // Global Scenes are always in WGS84, but can support WebMercator SRs if the tiling Scheme is set to SceneViewTilingScheme::WebMercator
+        if (scene->sceneViewTilingScheme() == SceneViewTilingScheme::WebMercator)
+        {
+          return SpatialReference::webMercator();
+        }
+      }
+      return geoModel->spatialReference();
+    }
+
+    /*!
+      \internal
+      Returns whether \a geoModel is a global scene using the geographic tiling scheme, which accepts any geographic basemap.
+     */
+    bool usesGeographicTiling(GeoModel* geoModel)
+    {
+      auto* scene = qobject_cast<Scene*>(geoModel);
+      return scene && scene->sceneViewTilingScheme() == SceneViewTilingScheme::Geographic;
+    }
+
+    /*!
+      \internal
+      Returns a key which changes whenever the compatibility of basemaps with \a geoModel may have changed.
+     */
+    QString compatibilityKey(GeoModel* geoModel)
+    {
+      if (!geoModel)
+      {
+        return QStringLiteral("none");
+      }
+
+      return (usesGeographicTiling(geoModel) ? QStringLiteral("geographic|") : QStringLiteral("|")) + effectiveSpatialReference(geoModel).toJson();
+    }
+
     /*!
       \internal
       Triggered when a basemap is added to the gallery.
 
       1. We listen for GalleryItem changes.
-      2. We force the basemap to load if not already.
-      3. We emit BasemapGalleryController::currentBasemapChanged if the current basemap was
+      2. We emit BasemapGalleryController::currentBasemapChanged if the current basemap was
       added to the gallery.
+
+      The basemap is not loaded here, see BasemapGalleryController::scheduleBasemapLoads.
      */
     void onBasemapAddedToGallery(BasemapGalleryController* self, GenericListModel* gallery, const QModelIndex& index, BasemapGalleryItem* galleryItem)
     {
@@ -173,11 +221,6 @@ namespace Esri::ArcGISRuntime::Toolkit
 
       auto* basemap = galleryItem->basemap();
 
-      if (basemap && basemap->loadStatus() != LoadStatus::Loaded)
-      {
-        basemap->load();
-      }
-
       if (self->currentBasemap() == basemap)
       {
         // If the currently active basemap was added to the gallery, we notify
@@ -221,12 +264,12 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     /*!
       \internal
-      Takes a BasemapListModel*, sorts them alphabetically, and adds them to the basemap gallery.
+      Returns the basemaps of a BasemapListModel* sorted alphabetically.
 
       Because the basemaps are initially unloaded, Basemap->item() must be used to access the
       basemap metadata. The basemaps are sorted using Basemap->item()->title().
      */
-    void sortBasemapsAndAddToGallery(BasemapGalleryController* self, BasemapListModel* basemaps, bool is3D = false)
+    std::vector<Basemap*> sortedBasemaps(BasemapListModel* basemaps)
     {
       // Convert BasemapListModel into a Basemap* vector and sort basemaps alphabetically using the title
       std::vector<Basemap*> basemapsVector;
@@ -249,52 +292,28 @@ namespace Esri::ArcGISRuntime::Toolkit
         }
       });
 
-      for (auto* basemap : basemapsVector)
-      {
-        self->append(basemap, is3D);
-      }
+      return basemapsVector;
     }
 
     /*!
       \internal
-      Calls Portal::fetchDeveloperBasemapsAsync on the portal. Note that we do
-      not call Portal::fetchBasemapsAsync. The former call is for retrieving the modern API-key
-      metered basemaps, while the latter returns older-style basemaps. The latter is required
-      only when the user applies a custom portal, as it is also the call for retrieving an
-      enterprises's custom basemaps if set.
+      Takes a BasemapListModel*, sorts them alphabetically, and adds them to the basemap gallery.
      */
-    void setToDefaultBasemaps(BasemapGalleryController* self, Portal* portal)
+    void sortBasemapsAndAddToGallery(BasemapGalleryController* self, BasemapListModel* basemaps, bool is3D = false)
     {
-      // Load the portal and kick-off the group discovery.
-      QObject::connect(portal, &Portal::doneLoading, self, [portal, self](const Error& e)
+      for (auto* basemap : sortedBasemaps(basemaps))
       {
-        if (!e.isEmpty())
-        {
-          return;
-        }
-
-        portal->fetchDeveloperBasemapsAsync().then(self, [portal, self]()
-        {
-          // Sort and append the basemaps to the gallery.
-          BasemapListModel* basemaps = portal->developerBasemaps();
-          sortBasemapsAndAddToGallery(self, basemaps);
-          // Notify the demo that the basemaps have changed.
-          emit self->basemapsChanged();
-        });
+        self->append(basemap, is3D);
+      }
+    }
 
-        if (qobject_cast<Scene*>(self->geoModel()))
-        {
-          portal->fetch3DBasemapsAsync().then(self, [portal, self]()
-          {
-            // Sort and append the basemaps to the gallery.
-            BasemapListModel* basemaps = portal->basemaps3D();
-            sortBasemapsAndAddToGallery(self, basemaps, true);
-            // Notify the demo that the basemaps have changed.
-            emit self->basemapsChanged();
-          });
-        }
-      });
-      portal->load();
+    // The controller schedules the loads of its items' basemaps, so the items must not load them on construction.
+    BasemapGalleryItem* createGalleryItem(Basemap* basemap, QImage thumbnail, QString tooltip, bool is3D, QObject* parent)
+    {
+      auto* item = new BasemapGalleryItem(nullptr, std::move(thumbnail), std::move(tooltip), is3D, parent);
+      item->setLoadsBasemap(false);
+      item->setBasemap(basemap);
+      return item;
     }
   } // namespace
 
@@ -325,12 +344,30 @@ namespace Esri::ArcGISRuntime::Toolkit
         if (auto* galleryItem = m_gallery->element<BasemapGalleryItem>(index))
         {
           onBasemapAddedToGallery(this, m_gallery, index, galleryItem);
+          // cached for every row, so a later change of compatibility is always diffed and reported
+          isGalleryItemEnabled(galleryItem);
+          // the spatial reference of a basemap is only known once it and its first base layer have loaded
+          connect(galleryItem, &BasemapGalleryItem::basemapChanged, this, [this, galleryItem]
+          {
+            updateGalleryItemEnabled(galleryItem);
+
+            auto* basemap = galleryItem->basemap();
+            if (basemap && basemap->loadStatus() == LoadStatus::Loaded && !basemap->baseLayers()->isEmpty())
+            {
+              doWhenLoaded(basemap->baseLayers()->first(), galleryItem, [this, galleryItem]
+              {
+                updateGalleryItemEnabled(galleryItem);
+              });
+            }
+          });
         }
       }
+
+      scheduleBasemapLoads();
     });
 
-    // Listen in to items removed from the gallery.
-    connect(m_gallery, &GenericListModel::rowsRemoved, this, [this](const QModelIndex& parent, int first, int last)
+    // Listen in to items removed from the gallery, which can only be looked up before they are gone.
+    connect(m_gallery, &GenericListModel::rowsAboutToBeRemoved, this, [this](const QModelIndex& parent, int first, int last)
     {
       if (parent.isValid())
       {
@@ -342,14 +379,32 @@ namespace Esri::ArcGISRuntime::Toolkit
         auto index = m_gallery->index(i);
         if (auto* galleryItem = m_gallery->element<BasemapGalleryItem>(index))
         {
-          onBasemapRemovedFromGallery(this, galleryItem);
+          m_isGalleryItemEnabled.remove(galleryItem);
+          m_removedGalleryItems.append(galleryItem);
         }
       }
     });
+    connect(m_gallery, &GenericListModel::rowsRemoved, this, [this](const QModelIndex& parent)
+    {
+      if (parent.isValid())
+      {
+        return;
+      }
+
+      const auto removedGalleryItems = std::exchange(m_removedGalleryItems, {});
+      for (const auto& galleryItem : removedGalleryItems)
+      {
+        onBasemapRemovedFromGallery(this, galleryItem);
+      }
+    });
+    connect(m_gallery, &GenericListModel::modelAboutToBeReset, this, [this]
+    {
+      m_isGalleryItemEnabled.clear();
+    });
     m_gallery->setFlagsCallback([this](const QModelIndex& index)
     {
       BasemapGalleryItem* galleryItem = m_gallery->element<BasemapGalleryItem>(index);
-      if (!basemapMatchesCurrentSpatialReference(galleryItem->basemap()))
+      if (!isGalleryItemEnabled(galleryItem))
       {
         //disabled item flags
         return Qt::ItemFlags(Qt::NoItemFlags);
@@ -360,7 +415,9 @@ namespace Esri::ArcGISRuntime::Toolkit
         return Qt::ItemFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
       }
     });
-    setToDefaultBasemaps(this, m_portal);
+    // the selected basemap is loaded ahead of the others
+    connect(this, &BasemapGalleryController::currentBasemapChanged, this, &BasemapGalleryController::scheduleBasemapLoads);
+    // the default basemaps are only listed and fetched once a view shows the gallery, see fetchBasemaps
     // Have to set the property names, so the controller will know how to match the properties from
     // basemapgalleryitem with the specific Qt::<namespace> invoked in the .data() from the View (ListView) obj
     m_gallery->setDisplayPropertyName("name");
@@ -396,11 +453,16 @@ namespace Esri::ArcGISRuntime::Toolkit
       connectToGeoModel(this, m_geoModel);
       // guard from nullptr direct access
       setCurrentBasemap(geoModel->basemap());
+      // the spatial reference of the geo model is only known once it has loaded
+      doWhenLoaded(m_geoModel, this, [this]
+      {
+        updateGalleryItemsEnabled();
+      });
     }
 
     emit geoModelChanged();
-    //forcing all the items in the gallery to recalculate the ::ItemFlags for the view.
-    emit m_gallery->dataChanged(m_gallery->index(0), m_gallery->index(std::max(m_gallery->rowCount() - 1, 0)));
+    // only the items whose compatibility flipped are refreshed in the view
+    updateGalleryItemsEnabled();
   }
 
   GenericListModel* BasemapGalleryController::gallery() const
@@ -420,6 +482,10 @@ namespace Esri::ArcGISRuntime::Toolkit
       return;
     }
 
+    // a custom portal replaces the default basemaps, whether or not they were fetched
+    m_isDefaultPortal = false;
+    m_catalogItems.clear();
+
     if (m_portal)
     {
       disconnect(m_portal, nullptr, this, nullptr);
@@ -484,6 +550,153 @@ namespace Esri::ArcGISRuntime::Toolkit
     emit portalChanged();
   }
 
+  /*!
+    \internal
+    Lists the default basemaps of the portal, and starts fetching them, the first time the gallery is shown.
+
+    Views call this when they are first shown. The basemaps fetched on a previous run are listed straight away
+    from the catalog cache, and once the portal has been fetched only the basemaps which were added or
+    removed since are changed in the gallery. This does nothing once a custom portal has been set.
+
+    Calls Portal::fetchDeveloperBasemapsAsync on the portal. Note that we do
+    not call Portal::fetchBasemapsAsync. The former call is for retrieving the modern API-key
+    metered basemaps, while the latter returns older-style basemaps. The latter is required
+    only when the user applies a custom portal, as it is also the call for retrieving an
+    enterprises's custom basemaps if set.
+   */
+  void BasemapGalleryController::fetchBasemaps()
+  {
+    if (m_areDefaultBasemapsRequested || !m_isDefaultPortal || !m_portal)
+    {
+      return;
+    }
+
+    m_areDefaultBasemapsRequested = true;
+    const bool isScene = qobject_cast<Scene*>(m_geoModel) != nullptr;
+
+    appendCachedBasemaps(false);
+    if (isScene)
+    {
+      appendCachedBasemaps(true);
+    }
+
+    // Load the portal and kick-off the group discovery.
+    auto* portal = m_portal;
+    doOnLoaded(portal, this, [this, portal, isScene]
+    {
+      portal->fetchDeveloperBasemapsAsync().then(this, [this, portal]()
+      {
+        reconcileBasemaps(portal->developerBasemaps(), false);
+      });
+
+      if (isScene)
+      {
+        portal->fetch3DBasemapsAsync().then(this, [this, portal]()
+        {
+          reconcileBasemaps(portal->basemaps3D(), true);
+        });
+      }
+    });
+  }
+
+  /*!
+    \internal
+    Appends a basemap to the gallery for each of the 2D, or if \a is3D the 3D, basemaps the catalog cache holds for the portal.
+
+    The basemaps are created from their portal items, so they load like any other, and take the cached title until they have.
+   */
+  void BasemapGalleryController::appendCachedBasemaps(bool is3D)
+  {
+    const auto entries = m_catalogCache.find(BasemapGalleryCatalogCache::key(m_portal, is3D));
+    for (const auto& entry : entries)
+    {
+      // owned by the portal, as the basemaps it fetches are
+      auto* basemap = new Basemap(new PortalItem(m_portal, entry.itemId, m_portal), m_portal);
+      basemap->setName(entry.title);
+      if (append(basemap, is3D))
+      {
+        m_catalogItems.insert(catalogItemKey(entry.itemId, is3D),
+                              m_gallery->element<BasemapGalleryItem>(m_gallery->index(m_gallery->rowCount() - 1)));
+      }
+    }
+
+    if (!entries.isEmpty())
+    {
+      emit basemapsChanged();
+      prewarmRecentBasemaps(is3D);
+    }
+  }
+
+  /*!
+    \internal
+    Brings the gallery in line with the 2D, or if \a is3D the 3D, \a basemaps fetched from the portal, and stores them in the catalog cache.
+
+    Cached basemaps which are still in the portal are kept, so their rows, loads and thumbnails are untouched.
+   */
+  void BasemapGalleryController::reconcileBasemaps(BasemapListModel* basemaps, bool is3D)
+  {
+    QList<BasemapGalleryCatalogCache::Entry> entries;
+    QSet<QString> fetchedKeys;
+    bool isChanged = false;
+
+    for (auto* basemap : sortedBasemaps(basemaps))
+    {
+      auto* item = basemap->item();
+      if (!item || item->itemId().isEmpty())
+      {
+        isChanged = append(basemap, is3D) || isChanged;
+        continue;
+      }
+
+      const auto key = catalogItemKey(item->itemId(), is3D);
+      fetchedKeys.insert(key);
+      entries.append({item->itemId(), item->title(), is3D});
+
+      if (!m_catalogItems.contains(key))
+      {
+        isChanged = append(basemap, is3D) || isChanged;
+      }
+    }
+
+    for (auto it = m_catalogItems.begin(); it != m_catalogItems.end();)
+    {
+      if (!it.value())
+      {
+        // already removed from the gallery
+        it = m_catalogItems.erase(it);
+        continue;
+      }
+
+      if (it.value()->is3D() != is3D || fetchedKeys.contains(it.key()))
+      {
+        ++it;
+        continue;
+      }
+
+      // no longer offered by the portal
+      if (const auto row = basemapIndex(it.value()->basemap()); row >= 0)
+      {
+        m_gallery->removeRows(row, 1);
+        isChanged = true;
+      }
+      it = m_catalogItems.erase(it);
+    }
+
+    m_catalogCache.insert(BasemapGalleryCatalogCache::key(m_portal, is3D), entries);
+
+    if (isChanged)
+    {
+      // Notify the demo that the basemaps have changed.
+      emit basemapsChanged();
+      prewarmRecentBasemaps(is3D);
+    }
+  }
+
+  QString BasemapGalleryController::catalogItemKey(const QString& itemId, bool is3D)
+  {
+    return (is3D ? QStringLiteral("3D|") : QStringLiteral("2D|")) + itemId;
+  }
+
   Basemap* BasemapGalleryController::currentBasemap() const
   {
     return m_currentBasemap;
@@ -501,13 +714,25 @@ namespace Esri::ArcGISRuntime::Toolkit
         }
         if (!basemapMatchesCurrentSpatialReference(basemap))
         {
-          // force redraw for the single basemapGalleryItem updated
-          emit m_gallery->dataChanged(m_gallery->index(basemapIndex(basemap)), m_gallery->index(basemapIndex(basemap)));
+          // the base layer has just loaded, so the item's compatibility may have flipped
+          const auto row = basemapIndex(basemap);
+          if (row >= 0)
+          {
+            updateGalleryItemEnabled(m_gallery->element<BasemapGalleryItem>(m_gallery->index(row)));
+          }
           return;
         }
         m_currentBasemap = basemap;
         emit currentBasemapChanged();
 
+        // remembered so it is prewarmed on the next run
+        if (const auto row = basemapIndex(basemap); row >= 0 && basemap->item())
+        {
+          const bool is3D = m_gallery->element<BasemapGalleryItem>(m_gallery->index(row))->is3D();
+          m_catalogCache.touchRecentItemId(BasemapGalleryCatalogCache::key(m_portal, is3D), basemap->item()->itemId(),
+                                           m_recentBasemapPrewarmCount);
+        }
+
         if (m_geoModel && m_geoModel->basemap() != m_currentBasemap)
         {
           m_geoModel->setBasemap(m_currentBasemap);
@@ -535,19 +760,19 @@ namespace Esri::ArcGISRuntime::Toolkit
   bool BasemapGalleryController::append(Basemap* basemap)
   {
     std::lock_guard<std::mutex> lock(m_galleryAccessMutex);
-    return m_gallery->append(new BasemapGalleryItem(basemap, this));
+    return m_gallery->append(createGalleryItem(basemap, {}, {}, false, this));
   }
 
   bool BasemapGalleryController::append(Basemap* basemap, bool is3D)
   {
     std::lock_guard<std::mutex> lock(m_galleryAccessMutex);
-    return m_gallery->append(new BasemapGalleryItem(basemap, {}, {}, is3D, this));
+    return m_gallery->append(createGalleryItem(basemap, {}, {}, is3D, this));
   }
 
   bool BasemapGalleryController::append(Basemap* basemap, QImage thumbnail, QString tooltip)
   {
     std::lock_guard<std::mutex> lock(m_galleryAccessMutex);
-    return m_gallery->append(new BasemapGalleryItem(basemap, std::move(thumbnail), std::move(tooltip), this));
+    return m_gallery->append(createGalleryItem(basemap, std::move(thumbnail), std::move(tooltip), false, this));
   }
 
   int BasemapGalleryController::basemapIndex(Basemap* basemap) const
@@ -584,35 +809,445 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
 
     // For Global scenes using the Geographic tiling scheme, allow any geographic basemap SR.
-    if (auto* scene = qobject_cast<Scene*>(m_geoModel))
+    if (usesGeographicTiling(m_geoModel))
+    {
+      return basemapSR.isGeographic();
+    }
+
+    const SpatialReference geoModelSR = effectiveSpatialReference(m_geoModel);
+
+    // If no spatial reference is set, any basemap can be applied.
+    if (geoModelSR.isEmpty())
+    {
+      return true;
+    }
+
+    return basemapSR == geoModelSR;
+  }
+
+  /*!
+    \brief Tells the controller that the view shows the rows \a first to \a last of the gallery.
+
+    Basemaps are only loaded, and their thumbnails fetched, for the current basemap, the visible rows
+    and \l prefetchMargin rows either side of them. Until a view calls this every row is treated as
+    visible, so basemaps load in gallery order.
+   */
+  void BasemapGalleryController::setVisibleRange(int first, int last)
+  {
+    fetchBasemaps();
+
+    if (first == m_visibleFirst && last == m_visibleLast)
     {
-      if (scene->sceneViewTilingScheme() == SceneViewTilingScheme::Geographic)
+      return;
+    }
+
+    m_visibleFirst = first;
+    m_visibleLast = last;
+    scheduleBasemapLoads();
+  }
+
+  /*!
+    \internal
+    Starts loading the first base layer of \a basemap ahead of it being applied, so that selecting it does not
+    wait on the layer. Views call this when an item is hovered or focused.
+
+    At most \l prewarmBudget basemaps are prewarmed at the same time, \a basemap goes ahead of any waiting.
+   */
+  void BasemapGalleryController::prewarmBasemap(Basemap* basemap)
+  {
+    if (!basemap || m_prewarmBudget == 0)
+    {
+      return;
+    }
+
+    m_prewarmQueue.removeAll(basemap);
+    m_prewarmQueue.prepend(basemap);
+    processPrewarmQueue();
+  }
+
+  /*!
+    \internal
+    Queues the \l recentBasemapPrewarmCount basemaps most recently applied from the 2D, or if \a is3D the 3D,
+    catalog of the portal for prewarming, behind any hovered basemap.
+   */
+  void BasemapGalleryController::prewarmRecentBasemaps(bool is3D)
+  {
+    if (m_prewarmBudget == 0 || m_recentBasemapPrewarmCount == 0)
+    {
+      return;
+    }
+
+    const auto itemIds = m_catalogCache.recentItemIds(BasemapGalleryCatalogCache::key(m_portal, is3D))
+                           .mid(0, m_recentBasemapPrewarmCount);
+    for (const auto& itemId : itemIds)
+    {
+      for (int row = 0; row < m_gallery->rowCount(); ++row)
       {
-        return basemapSR.isGeographic();
+        auto* galleryItem = m_gallery->element<BasemapGalleryItem>(m_gallery->index(row));
+        auto* basemap = galleryItem ? galleryItem->basemap() : nullptr;
+        if (basemap && galleryItem->is3D() == is3D && basemap->item() && basemap->item()->itemId() == itemId)
+        {
+          if (!m_prewarmQueue.contains(basemap))
+          {
+            m_prewarmQueue.append(basemap);
+          }
+          break;
+        }
       }
     }
 
-    const SpatialReference geoModelSR = [](GeoModel* geoModel)
+    processPrewarmQueue();
+  }
+
+  void BasemapGalleryController::processPrewarmQueue()
+  {
+    while (m_prewarmingBasemaps.size() < m_prewarmBudget && !m_prewarmQueue.isEmpty())
     {
-      if (auto* scene = qobject_cast<Scene*>(geoModel))
+      auto* basemap = m_prewarmQueue.takeFirst().data();
+      if (!basemap || m_prewarmingBasemaps.contains(basemap) || basemap == m_currentBasemap)
       {
-        // Local Scenes use SceneViewTilingScheme::Automatic, so won't engage with this logic
-        // Global Scenes are always in WGS84, but can support WebMercator SRs if the tiling Scheme is set to SceneViewTilingScheme::WebMercator
-        if (scene->sceneViewTilingScheme() == SceneViewTilingScheme::WebMercator)
+        continue;
+      }
+
+      const auto* baseLayers = basemap->baseLayers();
+      if (basemap->loadStatus() == LoadStatus::Loaded &&
+          (baseLayers->isEmpty() || baseLayers->first()->loadStatus() == LoadStatus::Loaded))
+      {
+        // already warm
+        continue;
+      }
+
+      if (basemap->loadStatus() == LoadStatus::FailedToLoad ||
+          (basemap->loadStatus() == LoadStatus::Loaded && baseLayers->first()->loadStatus() == LoadStatus::FailedToLoad))
+      {
+        // load() does not retry a failed load, so doneLoading would never be emitted and the slot would leak
+        continue;
+      }
+
+      prewarm(basemap);
+    }
+  }
+
+  /*!
+    \internal
+    Loads \a basemap, then its first base layer, which is what setCurrentBasemap waits on.
+    Either one having failed to load before ends the prewarming at once, as doneLoading is not emitted again.
+   */
+  void BasemapGalleryController::prewarm(Basemap* basemap)
+  {
+    m_prewarmingBasemaps.insert(basemap);
+
+    const auto release = [this, basemap]
+    {
+      if (m_prewarmingBasemaps.remove(basemap))
+      {
+        processPrewarmQueue();
+      }
+    };
+
+    singleShotConnection(basemap, &QObject::destroyed, this, [release](QObject*)
+    {
+      release();
+    });
+
+    const auto loadBaseLayer = [this, basemap, release](const Error& e)
+    {
+      if (!e.isEmpty() || basemap->baseLayers()->isEmpty())
+      {
+        release();
+        return;
+      }
+
+      auto* layer = basemap->baseLayers()->first();
+      if (layer->loadStatus() == LoadStatus::Loaded || layer->loadStatus() == LoadStatus::FailedToLoad)
+      {
+        release();
+        return;
+      }
+
+      singleShotConnection(layer, &Layer::doneLoading, this, [this, basemap, release](const Error&)
+      {
+        // the spatial reference of the base layer is only known now, so the item may have become incompatible
+        if (const auto row = basemapIndex(basemap); row >= 0)
         {
-          return SpatialReference::webMercator();
+          updateGalleryItemEnabled(m_gallery->element<BasemapGalleryItem>(m_gallery->index(row)));
         }
+        release();
+      });
+      layer->load();
+    };
+
+    if (basemap->loadStatus() == LoadStatus::Loaded)
+    {
+      loadBaseLayer(Error{});
+    }
+    else if (basemap->loadStatus() == LoadStatus::FailedToLoad)
+    {
+      loadBaseLayer(basemap->loadError());
+    }
+    else
+    {
+      singleShotConnection(basemap, &Basemap::doneLoading, this, loadBaseLayer);
+      basemap->load();
+    }
+  }
+
+  /*!
+    \brief Returns the maximum number of basemaps loaded at the same time. Defaults to 4.
+   */
+  int BasemapGalleryController::maximumConcurrentLoads() const
+  {
+    return m_maximumConcurrentLoads;
+  }
+
+  void BasemapGalleryController::setMaximumConcurrentLoads(int maximumConcurrentLoads)
+  {
+    maximumConcurrentLoads = std::max(1, maximumConcurrentLoads);
+    if (m_maximumConcurrentLoads == maximumConcurrentLoads)
+    {
+      return;
+    }
+
+    m_maximumConcurrentLoads = maximumConcurrentLoads;
+    emit maximumConcurrentLoadsChanged();
+    scheduleBasemapLoads();
+  }
+
+  /*!
+    \brief Returns the number of rows either side of the visible ones which are loaded ahead of scrolling. Defaults to 4.
+   */
+  int BasemapGalleryController::prefetchMargin() const
+  {
+    return m_prefetchMargin;
+  }
+
+  void BasemapGalleryController::setPrefetchMargin(int prefetchMargin)
+  {
+    prefetchMargin = std::max(0, prefetchMargin);
+    if (m_prefetchMargin == prefetchMargin)
+    {
+      return;
+    }
+
+    m_prefetchMargin = prefetchMargin;
+    emit prefetchMarginChanged();
+    scheduleBasemapLoads();
+  }
+
+  /*!
+    \brief Returns the maximum number of basemaps prewarmed at the same time, 0 disables prewarming. Defaults to 2.
+   */
+  int BasemapGalleryController::prewarmBudget() const
+  {
+    return m_prewarmBudget;
+  }
+
+  void BasemapGalleryController::setPrewarmBudget(int prewarmBudget)
+  {
+    prewarmBudget = std::max(0, prewarmBudget);
+    if (m_prewarmBudget == prewarmBudget)
+    {
+      return;
+    }
+
+    m_prewarmBudget = prewarmBudget;
+    if (m_prewarmBudget == 0)
+    {
+      m_prewarmQueue.clear();
+    }
+    emit prewarmBudgetChanged();
+    processPrewarmQueue();
+  }
+
+  /*!
+    \brief Returns how many of the most recently applied basemaps are prewarmed once the gallery is listed. Defaults to 3.
+   */
+  int BasemapGalleryController::recentBasemapPrewarmCount() const
+  {
+    return m_recentBasemapPrewarmCount;
+  }
+
+  void BasemapGalleryController::setRecentBasemapPrewarmCount(int recentBasemapPrewarmCount)
+  {
+    recentBasemapPrewarmCount = std::max(0, recentBasemapPrewarmCount);
+    if (m_recentBasemapPrewarmCount == recentBasemapPrewarmCount)
+    {
+      return;
+    }
+
+    m_recentBasemapPrewarmCount = recentBasemapPrewarmCount;
+    emit recentBasemapPrewarmCountChanged();
+  }
+
+  /*!
+    \internal
+    Starts loading unloaded basemaps until \l maximumConcurrentLoads are loading.
+
+    The current basemap goes first, then the visible rows in order, then the prefetch
+    rows nearest the visible ones.
+   */
+  void BasemapGalleryController::scheduleBasemapLoads()
+  {
+    if (m_loadingBasemaps.size() >= m_maximumConcurrentLoads)
+    {
+      return;
+    }
+
+    const int rowCount = m_gallery->rowCount();
+    if (rowCount == 0)
+    {
+      return;
+    }
+
+    QList<int> rows;
+    rows.append(basemapIndex(m_currentBasemap));
+
+    if (m_visibleFirst < 0 || m_visibleLast < m_visibleFirst)
+    {
+      for (int row = 0; row < rowCount; ++row)
+      {
+        rows.append(row);
+      }
+    }
+    else
+    {
+      const int first = std::min(m_visibleFirst, rowCount - 1);
+      const int last = std::min(m_visibleLast, rowCount - 1);
+      for (int row = first; row <= last; ++row)
+      {
+        rows.append(row);
       }
-      return geoModel->spatialReference();
-    }(m_geoModel);
 
-    // If no spatial reference is set, any basemap can be applied.
-    if (geoModelSR.isEmpty())
+      for (int distance = 1; distance <= m_prefetchMargin; ++distance)
+      {
+        rows.append(last + distance);
+        rows.append(first - distance);
+      }
+    }
+
+    for (const int row : std::as_const(rows))
     {
-      return true;
+      if (m_loadingBasemaps.size() >= m_maximumConcurrentLoads)
+      {
+        return;
+      }
+
+      if (row < 0 || row >= rowCount)
+      {
+        continue;
+      }
+
+      auto* galleryItem = m_gallery->element<BasemapGalleryItem>(m_gallery->index(row));
+      auto* basemap = galleryItem ? galleryItem->basemap() : nullptr;
+      if (basemap && basemap->loadStatus() == LoadStatus::NotLoaded && !m_loadingBasemaps.contains(basemap))
+      {
+        loadBasemap(basemap);
+      }
     }
+  }
 
-    return basemapSR == geoModelSR;
+  /*!
+    \internal
+    Loads \a basemap, taking one of the \l maximumConcurrentLoads slots until it is done.
+   */
+  void BasemapGalleryController::loadBasemap(Basemap* basemap)
+  {
+    m_loadingBasemaps.insert(basemap);
+
+    const auto release = [this, basemap]
+    {
+      if (m_loadingBasemaps.remove(basemap))
+      {
+        scheduleBasemapLoads();
+      }
+    };
+
+    singleShotConnection(basemap, &Basemap::doneLoading, this, [release](const Error&)
+    {
+      release();
+    });
+    singleShotConnection(basemap, &QObject::destroyed, this, [release](QObject*)
+    {
+      release();
+    });
+
+    basemap->load();
+  }
+
+  /*!
+    \internal
+    Returns whether \a galleryItem can be selected, computing and caching its compatibility on first use.
+   */
+  bool BasemapGalleryController::isGalleryItemEnabled(BasemapGalleryItem* galleryItem)
+  {
+    if (!galleryItem)
+    {
+      return false;
+    }
+
+    if (auto it = m_isGalleryItemEnabled.constFind(galleryItem); it != m_isGalleryItemEnabled.cend())
+    {
+      return it.value();
+    }
+
+    const bool isEnabled = basemapMatchesCurrentSpatialReference(galleryItem->basemap());
+    m_isGalleryItemEnabled.insert(galleryItem, isEnabled);
+    return isEnabled;
+  }
+
+  /*!
+    \internal
+    Recomputes the compatibility of \a galleryItem, after its basemap or base layer changed, and
+    refreshes its row if it flipped.
+   */
+  void BasemapGalleryController::updateGalleryItemEnabled(BasemapGalleryItem* galleryItem)
+  {
+    if (!galleryItem)
+    {
+      return;
+    }
+
+    const bool isEnabled = basemapMatchesCurrentSpatialReference(galleryItem->basemap());
+    const auto it = m_isGalleryItemEnabled.find(galleryItem);
+    if (it != m_isGalleryItemEnabled.end() && it.value() == isEnabled)
+    {
+      return;
+    }
+
+    // a row which was never cached is reported too, as a view may have read its compatibility some other way
+    m_isGalleryItemEnabled.insert(galleryItem, isEnabled);
+    if (const auto row = basemapIndex(galleryItem->basemap()); row >= 0)
+    {
+      emit m_gallery->dataChanged(m_gallery->index(row), m_gallery->index(row));
+    }
+  }
+
+  /*!
+    \internal
+    Recomputes the compatibility of every gallery item if the geo model's effective spatial reference
+    or tiling scheme changed, refreshing only the rows which flipped.
+   */
+  void BasemapGalleryController::updateGalleryItemsEnabled()
+  {
+    const auto key = compatibilityKey(m_geoModel);
+    if (key == m_compatibilityKey)
+    {
+      return;
+    }
+
+    m_compatibilityKey = key;
+    for (auto it = m_isGalleryItemEnabled.begin(); it != m_isGalleryItemEnabled.end(); ++it)
+    {
+      const bool isEnabled = basemapMatchesCurrentSpatialReference(it.key()->basemap());
+      if (it.value() != isEnabled)
+      {
+        it.value() = isEnabled;
+        if (const auto row = basemapIndex(it.key()->basemap()); row >= 0)
+        {
+          emit m_gallery->dataChanged(m_gallery->index(row), m_gallery->index(row));
+        }
+      }
+    }
   }
 
   void BasemapGalleryController::setGeoModelFromGeoView(QObject* view)
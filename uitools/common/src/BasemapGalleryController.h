@@ -22,6 +22,7 @@
 #include <Portal.h>
 
 // Other headers
+#include "BasemapGalleryCatalogCache.h"
 #include "BasemapGalleryItem.h"
 #include "GenericListModel.h"
 
@@ -29,11 +30,20 @@
 #include <mutex>
 
 // Qt headers
+#include <QHash>
+#include <QList>
 #include <QObject>
+#include <QPointer>
+#include <QSet>
 
 // Qt forward declarations
 class QAbstractListModel;
 
+namespace Esri::ArcGISRuntime
+{
+  class BasemapListModel;
+} // namespace Esri::ArcGISRuntime
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
@@ -44,6 +54,10 @@ namespace Esri::ArcGISRuntime::Toolkit
     Q_PROPERTY(Portal* portal READ portal WRITE setPortal NOTIFY portalChanged)
     Q_PROPERTY(Basemap* currentBasemap READ currentBasemap NOTIFY currentBasemapChanged)
     Q_PROPERTY(QAbstractListModel* gallery READ gallery CONSTANT)
+    Q_PROPERTY(int maximumConcurrentLoads READ maximumConcurrentLoads WRITE setMaximumConcurrentLoads NOTIFY maximumConcurrentLoadsChanged)
+    Q_PROPERTY(int prefetchMargin READ prefetchMargin WRITE setPrefetchMargin NOTIFY prefetchMarginChanged)
+    Q_PROPERTY(int prewarmBudget READ prewarmBudget WRITE setPrewarmBudget NOTIFY prewarmBudgetChanged)
+    Q_PROPERTY(int recentBasemapPrewarmCount READ recentBasemapPrewarmCount WRITE setRecentBasemapPrewarmCount NOTIFY recentBasemapPrewarmCountChanged)
   public:
     Q_INVOKABLE BasemapGalleryController(QObject* parent = nullptr);
 
@@ -75,18 +89,73 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     Q_INVOKABLE void setGeoModelFromGeoView(QObject* view);
 
+    Q_INVOKABLE void setVisibleRange(int first, int last);
+
+    Q_INVOKABLE void fetchBasemaps();
+
+    Q_INVOKABLE void prewarmBasemap(Basemap* basemap);
+
+    int maximumConcurrentLoads() const;
+    void setMaximumConcurrentLoads(int maximumConcurrentLoads);
+
+    int prefetchMargin() const;
+    void setPrefetchMargin(int prefetchMargin);
+
+    int prewarmBudget() const;
+    void setPrewarmBudget(int prewarmBudget);
+
+    int recentBasemapPrewarmCount() const;
+    void setRecentBasemapPrewarmCount(int recentBasemapPrewarmCount);
+
   signals:
     void geoModelChanged();
     void portalChanged();
     void basemapsChanged();
     void currentBasemapChanged();
+    void maximumConcurrentLoadsChanged();
+    void prefetchMarginChanged();
+    void prewarmBudgetChanged();
+    void recentBasemapPrewarmCountChanged();
 
   private:
+    void scheduleBasemapLoads();
+    void loadBasemap(Basemap* basemap);
+    bool isGalleryItemEnabled(BasemapGalleryItem* galleryItem);
+    void updateGalleryItemEnabled(BasemapGalleryItem* galleryItem);
+    void updateGalleryItemsEnabled();
+    void appendCachedBasemaps(bool is3D);
+    void reconcileBasemaps(BasemapListModel* basemaps, bool is3D);
+    static QString catalogItemKey(const QString& itemId, bool is3D);
+    void prewarmRecentBasemaps(bool is3D);
+    void processPrewarmQueue();
+    void prewarm(Basemap* basemap);
+
     Basemap* m_currentBasemap = nullptr;
     GeoModel* m_geoModel = nullptr;
     Portal* m_portal = nullptr;
     GenericListModel* m_gallery = nullptr;
     std::mutex m_galleryAccessMutex;
+    // rows the view shows, -1 until a view reports them, in which case every row is treated as visible
+    int m_visibleFirst = -1;
+    int m_visibleLast = -1;
+    int m_prefetchMargin = 4;
+    int m_maximumConcurrentLoads = 4;
+    QSet<Basemap*> m_loadingBasemaps;
+    // whether each gallery item's basemap can be applied to the geo model, valid for m_compatibilityKey
+    QHash<BasemapGalleryItem*, bool> m_isGalleryItemEnabled;
+    // gallery items whose rows are being removed, handled once they are gone
+    QList<QPointer<BasemapGalleryItem>> m_removedGalleryItems;
+    QString m_compatibilityKey;
+    BasemapGalleryCatalogCache m_catalogCache;
+    // gallery items listed from m_catalogCache, by catalogItemKey, until the portal has been fetched
+    QHash<QString, QPointer<BasemapGalleryItem>> m_catalogItems;
+    bool m_isDefaultPortal = true;
+    bool m_areDefaultBasemapsRequested = false;
+    // basemaps whose first base layer is loaded ahead of being applied, the most urgent first
+    QList<QPointer<Basemap>> m_prewarmQueue;
+    QSet<Basemap*> m_prewarmingBasemaps;
+    int m_prewarmBudget = 2;
+    int m_recentBasemapPrewarmCount = 3;
   };
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -21,14 +21,15 @@
 
 // Toolkit headers
 #include "BasemapGalleryItem.h"
-#include "DoOnLoad.h"
-
-// ArcGISRuntime headers
-#include <Item.h>
 
 // Qt headers
 #include <QFuture>
-#include <QIcon>
+#include <QPromise>
+#include <QThreadPool>
+
+// std headers
+#include <algorithm>
+#include <memory>
 
 namespace Esri::ArcGISRuntime::Toolkit
 {
@@ -47,13 +48,17 @@ namespace Esri::ArcGISRuntime::Toolkit
     class BasemapGalleryImageResponse : public QQuickImageResponse
     {
     public:
-      BasemapGalleryImageResponse(BasemapGalleryItem* galleryItem, QSize requestedSize);
+      BasemapGalleryImageResponse(BasemapGalleryItem* galleryItem, QSize requestedSize, BasemapGalleryImageProvider* provider);
       ~BasemapGalleryImageResponse() override;
       QQuickTextureFactory* textureFactory() const override;
 
     private:
+      void deliver();
+
       QPointer<BasemapGalleryItem> m_galleryItem;
       QSize m_requestedSize;
+      BasemapGalleryImageProvider* m_provider = nullptr;
+      QImage m_texture;
     };
 
     /*!
@@ -62,18 +67,20 @@ namespace Esri::ArcGISRuntime::Toolkit
       \list
         \li \a galleryItem The item to grab a thumbnail for.
         \li \a requestedSize The size of image requested.
+        \li \a provider The provider caching scaled thumbnails.
       \endlist
 
-      Internally, we test the state of the GalleryItem. If there is a thumbnail available we return this immediately,
-      otherwise we will attempt to fetch the thumbnail from the associated \c{Item} if and when it is available.
+      Internally, we test the state of the GalleryItem. If there is a thumbnail available, from its \c{Item} or the
+      thumbnail cache, we return this immediately, otherwise we wait for the GalleryItem to fetch it.
      */
-    BasemapGalleryImageResponse::BasemapGalleryImageResponse(BasemapGalleryItem* galleryItem, QSize requestedSize) :
+    BasemapGalleryImageResponse::BasemapGalleryImageResponse(BasemapGalleryItem* galleryItem, QSize requestedSize, BasemapGalleryImageProvider* provider) :
       m_galleryItem(galleryItem),
-      m_requestedSize(std::move(requestedSize))
+      m_requestedSize(std::move(requestedSize)),
+      m_provider(provider)
     {
       if (!m_galleryItem)
       {
-        emit finished();
+        deliver();
         return;
       }
 
@@ -81,38 +88,74 @@ namespace Esri::ArcGISRuntime::Toolkit
       if (!thumbnail.isNull())
       {
         // We have a thumbnail to display so just go ahead and display this.
-        emit finished();
+        deliver();
         return;
       }
 
-      // Otherwise attempt a thumbnail fetch.
-      auto* basemap = m_galleryItem->basemap();
-      if (!basemap)
+      // Otherwise wait for the item to fetch its thumbnail, which happens once the gallery
+      // controller has loaded its basemap. Loading it here would defeat the controller's scheduling.
+      connect(galleryItem, &BasemapGalleryItem::thumbnailChanged, this, [this]
+      {
+        if (m_galleryItem && !m_galleryItem->thumbnail().isNull())
+        {
+          disconnect(m_galleryItem, nullptr, this, nullptr);
+          deliver();
+        }
+      });
+      connect(galleryItem, &QObject::destroyed, this, [this]
+      {
+        deliver();
+      });
+    }
+
+    /*!
+      \internal
+      \brief Prepares the texture for the current thumbnail of the GalleryItem, then emits finished.
+
+      Textures already in the provider's cache are used as they are. Otherwise the thumbnail is
+      scaled, or the default thumbnail rasterized, on a worker thread and the result cached.
+     */
+    void BasemapGalleryImageResponse::deliver()
+    {
+      const auto thumbnail = m_galleryItem ? m_galleryItem->thumbnail() : QImage{};
+      const auto size = m_requestedSize.isValid() ? m_requestedSize : (thumbnail.isNull() ? QSize(200, 133) : thumbnail.size());
+      const auto sizeKey = QStringLiteral("%1x%2").arg(size.width()).arg(size.height());
+      // QImage::cacheKey changes whenever the thumbnail does, so stale textures are never hit
+      const auto key = thumbnail.isNull() ? QStringLiteral("default/") + sizeKey
+                                          : QStringLiteral("%1/%2/").arg(m_galleryItem->id().toString(QUuid::WithoutBraces)).arg(thumbnail.cacheKey()) + sizeKey;
+
+      m_texture = m_provider->texture(key);
+      if (!m_texture.isNull())
       {
         emit finished();
         return;
       }
 
-      doOnLoaded(basemap, this, [this, basemap]
+      auto promise = std::make_shared<QPromise<QImage>>();
+      auto future = promise->future();
+      QThreadPool::globalInstance()->start([promise, thumbnail, size]()
       {
-        auto item = basemap->item();
-        if (!item)
+        promise->start();
+        if (thumbnail.isNull())
         {
-          emit finished();
-          return;
+          promise->addResult(BasemapGalleryItem::defaultThumbnail(size));
         }
-
-        auto itemThumbnail = item->thumbnail();
-        if (!itemThumbnail.isNull())
+        else if (thumbnail.size() == size)
         {
-          // We have a good thumbnail.
-          emit finished();
-          return;
+          promise->addResult(thumbnail);
         }
-        item->fetchThumbnailAsync().then(this, [this](QImage)
+        else
         {
-          emit finished();
-        });
+          promise->addResult(thumbnail.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+        }
+        promise->finish();
+      });
+
+      future.then(this, [this, key](const QImage& texture)
+      {
+        m_texture = texture;
+        m_provider->insertTexture(key, texture);
+        emit finished();
       });
     }
 
@@ -126,25 +169,12 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     /*!
       \internal
-      \brief Returns the thumbnail as a TextureFactory. If the thumbnail is null, returns a default
-      image instead.
+      \brief Returns the prepared thumbnail as a TextureFactory. If the thumbnail is null, this is
+      a default image instead.
      */
     QQuickTextureFactory* BasemapGalleryImageResponse::textureFactory() const
     {
-      QImage thumbnail;
-
-      if (m_galleryItem)
-      {
-        thumbnail = m_galleryItem->thumbnail();
-      }
-
-      if (thumbnail.isNull())
-      {
-        QIcon icon{QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/basemap.svg")};
-        thumbnail = icon.pixmap(200, 133).toImage();
-      }
-
-      return QQuickTextureFactory::textureFactoryForImage(m_requestedSize.isValid() ? thumbnail.scaled(m_requestedSize) : thumbnail);
+      return QQuickTextureFactory::textureFactoryForImage(m_texture);
     }
   } // namespace
 
@@ -188,7 +218,8 @@ namespace Esri::ArcGISRuntime::Toolkit
     \brief Private constructor of singleton.
    */
   BasemapGalleryImageProvider::BasemapGalleryImageProvider() :
-    m_internalObject(new QObject)
+    m_internalObject(new QObject),
+    m_textures(16 * 1024 * 1024)
   {
   }
 
@@ -250,7 +281,28 @@ namespace Esri::ArcGISRuntime::Toolkit
   QQuickImageResponse* BasemapGalleryImageProvider::requestImageResponse(const QString& id, const QSize& requestedSize)
   {
     auto itemIt = m_itemMap.find(QUuid::fromString(id));
-    return new BasemapGalleryImageResponse(itemIt == std::end(m_itemMap) ? nullptr : itemIt.value(), requestedSize);
+    return new BasemapGalleryImageResponse(itemIt == std::end(m_itemMap) ? nullptr : itemIt.value(), requestedSize, this);
+  }
+
+  /*!
+    \internal
+    \brief Returns the texture cached under \a key, or a null image if there is none.
+   */
+  QImage BasemapGalleryImageProvider::texture(const QString& key)
+  {
+    const QMutexLocker locker(&m_texturesMutex);
+    const auto* texture = m_textures.object(key);
+    return texture ? *texture : QImage{};
+  }
+
+  /*!
+    \internal
+    \brief Caches \a texture under \a key, evicting the least recently used textures beyond the budget.
+   */
+  void BasemapGalleryImageProvider::insertTexture(const QString& key, const QImage& texture)
+  {
+    const QMutexLocker locker(&m_texturesMutex);
+    m_textures.insert(key, new QImage(texture), std::max<qsizetype>(1, texture.sizeInBytes()));
   }
 
 #endif // CPP_ARCGISRUNTIME_TOOLKIT
@@ -18,6 +18,9 @@
 
 #ifdef CPP_ARCGISRUNTIME_TOOLKIT
 
+#include <QCache>
+#include <QImage>
+#include <QMutex>
 #include <QQuickImageProvider>
 #include <QUuid>
 
@@ -40,10 +43,16 @@ namespace Esri::ArcGISRuntime::Toolkit
     bool registerItem(BasemapGalleryItem* item);
     bool deregisterItem(BasemapGalleryItem* item);
 
+    QImage texture(const QString& key);
+    void insertTexture(const QString& key, const QImage& texture);
+
   private:
     BasemapGalleryImageProvider();
     QObject* m_internalObject;
     QMap<QUuid, BasemapGalleryItem*> m_itemMap;
+    // scaled thumbnails ready for display, keyed by item, thumbnail and size, costed in bytes
+    QMutex m_texturesMutex;
+    QCache<QString, QImage> m_textures;
   };
 } // namespace Esri::ArcGISRuntime::Toolkit
 
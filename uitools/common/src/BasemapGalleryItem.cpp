@@ -21,6 +21,7 @@
 
 // Toolkit headers
 #include "BasemapGalleryImageProvider.h"
+#include "BasemapGalleryThumbnailCache.h"
 #include "DoOnLoad.h"
 
 // ArcGISRuntime headers
@@ -31,7 +32,10 @@
 
 // Qt headers
 #include <QFuture>
-#include <QIcon>
+#include <QHash>
+#include <QMutex>
+#include <QPainter>
+#include <QSvgRenderer>
 
 #ifdef CPP_ARCGISRUNTIME_TOOLKIT
 // Qt headers
@@ -157,39 +161,69 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
 
     m_basemap = basemap;
+    m_cachedThumbnail = {};
 
     if (m_basemap)
     {
-      doOnLoaded(m_basemap.data(), this, [this, basemap]
+      if (auto* item = m_basemap->item())
       {
-        emit basemapChanged();
-        auto* item = basemap->item();
-        if (!item)
-        {
-          return;
-        }
+        // shown straight away, even offline, before the basemap has loaded
+        m_cachedThumbnail = BasemapGalleryThumbnailCache::instance()->find(item->itemId());
+      }
 
-        const auto itemThumbnail = item->thumbnail();
-        if (!itemThumbnail.isNull())
+      if (m_loadsBasemap)
+      {
+        doOnLoaded(m_basemap.data(), this, [this]
+        {
+          onBasemapLoaded();
+        });
+      }
+      else
+      {
+        // the gallery controller decides when the basemap loads, the thumbnail is only fetched once it has
+        doWhenLoaded(m_basemap.data(), this, [this]
         {
-          // We have a good thumbnail.
+          onBasemapLoaded();
+        });
+      }
+    }
+    emit basemapChanged();
+  }
+
+  void BasemapGalleryItem::onBasemapLoaded()
+  {
+    emit basemapChanged();
+    auto* item = m_basemap ? m_basemap->item() : nullptr;
+    if (!item)
+    {
+      return;
+    }
 
-          return;
-        }
+    const auto itemThumbnail = item->thumbnail();
+    if (!itemThumbnail.isNull())
+    {
+      // We have a good thumbnail.
+      cacheThumbnail(itemThumbnail);
+      return;
+    }
 
-        // fetchThumbnailAsync returns a single future, so don't keep attaching continuations
-        // if it's already running
-        auto future = item->fetchThumbnailAsync();
-        if (!future.isRunning())
-        {
-          future.then(this, [this](const QImage&)
-          {
-            emit basemapChanged();
-          });
-        }
+    if (!m_cachedThumbnail.image.isNull() && m_cachedThumbnail.itemModified == item->modified())
+    {
+      // the item has not changed since its thumbnail was cached, so there is no need to fetch it again
+      return;
+    }
+
+    // fetchThumbnailAsync returns a single future, so don't keep attaching continuations
+    // if it's already running
+    auto future = item->fetchThumbnailAsync();
+    if (!future.isRunning())
+    {
+      future.then(this, [this](const QImage& thumbnail)
+      {
+        cacheThumbnail(thumbnail);
+        emit basemapChanged();
       });
     }
-    emit basemapChanged();
   }
 
   QString BasemapGalleryItem::name() const
@@ -203,12 +237,12 @@ namespace Esri::ArcGISRuntime::Toolkit
     {
       if (auto* item = m_basemap->item())
       {
-        return item->thumbnail();
+        auto itemThumbnail = item->thumbnail();
+        return itemThumbnail.isNull() ? m_cachedThumbnail.image : itemThumbnail;
       }
       else
       {
-        QIcon icon{QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/basemap.svg")};
-        return icon.pixmap(200, 133).toImage();
+        return defaultThumbnail(QSize(200, 133));
       }
     }
     return m_thumbnail;
@@ -277,9 +311,71 @@ namespace Esri::ArcGISRuntime::Toolkit
   }
 #endif // CPP_ARCGISRUNTIME_TOOLKIT
 
+  /*!
+    \brief Returns whether the item loads its basemap itself, before fetching its thumbnail. Defaults to \c true.
+
+    A gallery controller which schedules the loads of its basemaps clears this before setting the basemap.
+   */
+  bool BasemapGalleryItem::loadsBasemap() const
+  {
+    return m_loadsBasemap;
+  }
+
+  void BasemapGalleryItem::setLoadsBasemap(bool loadsBasemap)
+  {
+    m_loadsBasemap = loadsBasemap;
+  }
+
   QUuid BasemapGalleryItem::id() const
   {
     return m_id;
   }
 
+  /*!
+    \internal
+    \brief Returns the placeholder thumbnail for basemaps without one, scaled to fit within \a size.
+
+    The SVG is rasterized once per size. This is safe to call from any thread.
+   */
+  QImage BasemapGalleryItem::defaultThumbnail(const QSize& size)
+  {
+    static QMutex mutex;
+    static QHash<QPair<int, int>, QImage> thumbnails;
+
+    const QMutexLocker locker(&mutex);
+    const auto key = qMakePair(size.width(), size.height());
+    if (auto it = thumbnails.constFind(key); it != thumbnails.cend())
+    {
+      return it.value();
+    }
+
+    // fitted rather than padded to size, as QIcon::pixmap did, so the placeholder keeps its own aspect ratio
+    QSvgRenderer renderer(QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/basemap.svg"));
+    QImage image(renderer.defaultSize().scaled(size, Qt::KeepAspectRatio), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    renderer.render(&painter);
+    painter.end();
+
+    thumbnails.insert(key, image);
+    return image;
+  }
+
+  /*!
+    \internal
+    \brief Stores \a thumbnail of the basemap's item in the thumbnail cache, unless it is already there.
+   */
+  void BasemapGalleryItem::cacheThumbnail(const QImage& thumbnail)
+  {
+    auto* item = m_basemap ? m_basemap->item() : nullptr;
+    if (!item || thumbnail.isNull() || (!m_cachedThumbnail.image.isNull() && m_cachedThumbnail.itemModified == item->modified()))
+    {
+      return;
+    }
+
+    BasemapGalleryThumbnailCache::instance()->insert(item->itemId(), item->modified(), thumbnail);
+    m_cachedThumbnail = {};
+  }
+
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -27,6 +27,9 @@
 // STL headers
 #include <Basemap.h>
 
+// Other headers
+#include "BasemapGalleryThumbnailCache.h"
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
@@ -73,6 +76,11 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     QUuid id() const;
 
+    bool loadsBasemap() const;
+    void setLoadsBasemap(bool loadsBasemap);
+
+    static QImage defaultThumbnail(const QSize& size);
+
   signals:
     void basemapChanged();
     void tooltipChanged();
@@ -82,11 +90,18 @@ namespace Esri::ArcGISRuntime::Toolkit
     void is3DChanged();
 
   private:
+    void cacheThumbnail(const QImage& thumbnail);
+    void onBasemapLoaded();
+
     QPointer<Basemap> m_basemap;
     QImage m_thumbnail;
+    // read from the thumbnail cache, shown until the item's own thumbnail is available
+    BasemapGalleryThumbnailCache::Thumbnail m_cachedThumbnail;
     QString m_tooltip;
     QUuid m_id;
     bool m_is3D = false;
+    // cleared by a gallery controller which schedules the loads of its basemaps itself
+    bool m_loadsBasemap = true;
   };
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "BasemapGalleryThumbnailCache.h"
+
+// Qt headers
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    constexpr quint32 fileMagic = 0x42475443; // "BGTC"
+    // bump when the layout of the file changes, files of other versions are treated as missing
+    constexpr quint32 fileVersion = 1;
+    const QString fileSuffix = QStringLiteral(".thumbnail");
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::BasemapGalleryThumbnailCache
+    \brief A size-capped directory of basemap thumbnails, keyed by portal item id.
+
+    Thumbnails are scaled to \l thumbnailSize and stored as raw premultiplied pixels,
+    so reading one back is a single read with no image decoding. Each file records the
+    modification time of the portal item it was fetched for, so a thumbnail can be shown
+    before the item loads and revalidated once it has. Files are touched when read and
+    the least recently used ones are removed once the cache outgrows \l maximumBytes.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  /*!
+    \internal
+    \brief Returns the cache shared by every basemap gallery, stored in the application's cache directory.
+   */
+  BasemapGalleryThumbnailCache* BasemapGalleryThumbnailCache::instance()
+  {
+    static BasemapGalleryThumbnailCache self{
+      QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).filePath(QStringLiteral("BasemapGallery/thumbnails"))};
+    return &self;
+  }
+
+  BasemapGalleryThumbnailCache::BasemapGalleryThumbnailCache(const QString& directory) :
+    m_directory(directory)
+  {
+  }
+
+  /*!
+    \internal
+    \brief Returns the size thumbnails are scaled to fit before being stored, that of the default thumbnail.
+   */
+  QSize BasemapGalleryThumbnailCache::thumbnailSize()
+  {
+    return QSize(200, 133);
+  }
+
+  /*!
+    \internal
+    \brief Returns the thumbnail stored for \a itemId, with a null image if there is none.
+   */
+  BasemapGalleryThumbnailCache::Thumbnail BasemapGalleryThumbnailCache::find(const QString& itemId) const
+  {
+    if (itemId.isEmpty())
+    {
+      return {};
+    }
+
+    QFile file(filePath(itemId));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+      return {};
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint64 modified = 0;
+    qint32 width = 0;
+    qint32 height = 0;
+    stream >> magic >> version >> modified >> width >> height;
+    if (stream.status() != QDataStream::Ok || magic != fileMagic || version != fileVersion || width <= 0 || height <= 0 ||
+        width > thumbnailSize().width() || height > thumbnailSize().height())
+    {
+      return {};
+    }
+
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    const auto bytes = static_cast<int>(image.sizeInBytes());
+    if (stream.readRawData(reinterpret_cast<char*>(image.bits()), bytes) != bytes)
+    {
+      return {};
+    }
+
+    // marks the thumbnail as recently used for eviction. This needs the file to be open, and on some
+    // platforms open for writing, so it is reopened without truncating if the read handle is not enough.
+    const auto now = QDateTime::currentDateTimeUtc();
+    if (!file.setFileTime(now, QFileDevice::FileModificationTime))
+    {
+      file.close();
+      if (!file.open(QIODevice::ReadWrite) || !file.setFileTime(now, QFileDevice::FileModificationTime))
+      {
+        qDebug() << "Could not mark the basemap thumbnail" << file.fileName() << "as recently used" << file.errorString();
+      }
+    }
+    file.close();
+
+    return {image, QDateTime::fromMSecsSinceEpoch(modified)};
+  }
+
+  /*!
+    \internal
+    \brief Stores \a image for \a itemId, last modified at \a itemModified, replacing any earlier thumbnail.
+   */
+  void BasemapGalleryThumbnailCache::insert(const QString& itemId, const QDateTime& itemModified, const QImage& image)
+  {
+    if (itemId.isEmpty() || image.isNull() || m_directory.isEmpty())
+    {
+      return;
+    }
+
+    const auto scaled = image.size().boundedTo(thumbnailSize()) == image.size()
+                          ? image.convertToFormat(QImage::Format_ARGB32_Premultiplied)
+                          : image.scaled(thumbnailSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation)
+                              .convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    QDir().mkpath(m_directory);
+
+    QSaveFile file(filePath(itemId));
+    if (!file.open(QIODevice::WriteOnly))
+    {
+      qDebug() << "Could not cache basemap thumbnail" << file.fileName() << file.errorString();
+      return;
+    }
+
+    QDataStream stream(&file);
+    stream << fileMagic << fileVersion << static_cast<qint64>(itemModified.toMSecsSinceEpoch()) << static_cast<qint32>(scaled.width())
+           << static_cast<qint32>(scaled.height());
+
+    // 32-bit scanlines are never padded, so the bits are exactly the pixels
+    stream.writeRawData(reinterpret_cast<const char*>(scaled.constBits()), static_cast<int>(scaled.sizeInBytes()));
+
+    if (!file.commit())
+    {
+      qDebug() << "Could not cache basemap thumbnail" << file.fileName() << file.errorString();
+      return;
+    }
+
+    evict();
+  }
+
+  qint64 BasemapGalleryThumbnailCache::maximumBytes() const
+  {
+    return m_maximumBytes;
+  }
+
+  void BasemapGalleryThumbnailCache::setMaximumBytes(qint64 maximumBytes)
+  {
+    m_maximumBytes = maximumBytes;
+    evict();
+  }
+
+  QString BasemapGalleryThumbnailCache::filePath(const QString& itemId) const
+  {
+    // item ids are hex in practice, hashing keeps any other id a valid file name
+    const auto name = QCryptographicHash::hash(itemId.toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QDir(m_directory).filePath(QString::fromLatin1(name) + fileSuffix);
+  }
+
+  void BasemapGalleryThumbnailCache::evict() const
+  {
+    // least recently used last
+    auto files = QDir(m_directory).entryInfoList({QLatin1Char('*') + fileSuffix}, QDir::Files, QDir::Time);
+
+    qint64 totalBytes = 0;
+    for (const auto& file : std::as_const(files))
+    {
+      totalBytes += file.size();
+    }
+
+    while (totalBytes > m_maximumBytes && !files.isEmpty())
+    {
+      const auto file = files.takeLast();
+      totalBytes -= file.size();
+      QFile::remove(file.absoluteFilePath());
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
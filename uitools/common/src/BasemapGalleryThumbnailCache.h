@@ -0,0 +1,61 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_BASEMAPGALLERYTHUMBNAILCACHE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_BASEMAPGALLERYTHUMBNAILCACHE_H
+
+// Qt headers
+#include <QDateTime>
+#include <QImage>
+#include <QSize>
+#include <QString>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class BasemapGalleryThumbnailCache
+  {
+  public:
+    struct Thumbnail
+    {
+      QImage image;
+      // modification time of the portal item the thumbnail was fetched for
+      QDateTime itemModified;
+    };
+
+    static BasemapGalleryThumbnailCache* instance();
+
+    explicit BasemapGalleryThumbnailCache(const QString& directory);
+
+    static QSize thumbnailSize();
+
+    Thumbnail find(const QString& itemId) const;
+
+    void insert(const QString& itemId, const QDateTime& itemModified, const QImage& image);
+
+    qint64 maximumBytes() const;
+    void setMaximumBytes(qint64 maximumBytes);
+
+  private:
+    QString filePath(const QString& itemId) const;
+    void evict() const;
+
+    QString m_directory;
+    qint64 m_maximumBytes = 16 * 1024 * 1024;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_BASEMAPGALLERYTHUMBNAILCACHE_H
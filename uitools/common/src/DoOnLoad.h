@@ -75,6 +75,34 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
   }
 
+  /*
+    \internal
+    \brief Executes method \a f immediately if \a sender is loaded, otherwise
+    executes \a f once something else has loaded \a sender.
+    Unlike \c doOnLoaded, this never starts loading \a sender itself.
+    Returns a connection object which may be default-constructed.
+ */
+  template<typename Target, typename Func>
+  QMetaObject::Connection doWhenLoaded(Target* sender, QObject* receiver, Func&& f)
+  {
+    static_assert(std::is_convertible<Target*, ::Esri::ArcGISRuntime::Loadable*>::value, "Target type must use Loadable interface");
+    static_assert(std::is_convertible<Target*, QObject*>::value, "Target type must be a QObject");
+
+    if (sender->loadStatus() == LoadStatus::Loaded)
+    {
+      f();
+      return QMetaObject::Connection{};
+    }
+
+    return QObject::connect(sender, &Target::loadStatusChanged, receiver, [f = std::forward<Func>(f)](LoadStatus loadStatus)
+    {
+      if (loadStatus == LoadStatus::Loaded)
+      {
+        f();
+      }
+    });
+  }
+
 } // namespace Esri::ArcGISRuntime::Toolkit
 
 #endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_DOONLOAD_H
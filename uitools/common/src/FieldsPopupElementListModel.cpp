@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "FieldsPopupElementListModel.h"
+
+// std headers
+#include <algorithm>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::FieldsPopupElementListModel
+    \brief The labels and formatted values of a fields popup element, with \c label and \c formattedValue roles.
+
+    The model is updated in place, so views only rebuild the delegates of fields which actually changed.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  FieldsPopupElementListModel::FieldsPopupElementListModel(QObject* parent) :
+    QAbstractListModel(parent)
+  {
+  }
+
+  FieldsPopupElementListModel::~FieldsPopupElementListModel() = default;
+
+  int FieldsPopupElementListModel::rowCount(const QModelIndex& parent) const
+  {
+    return parent.isValid() ? 0 : static_cast<int>(m_labels.size());
+  }
+
+  QVariant FieldsPopupElementListModel::data(const QModelIndex& index, int role) const
+  {
+    if (index.row() < 0 || index.row() >= rowCount())
+    {
+      return {};
+    }
+
+    switch (role)
+    {
+      case LabelRole:
+        return m_labels.at(index.row());
+      case FormattedValueRole:
+        return m_formattedValues.at(index.row());
+      default:
+        return {};
+    }
+  }
+
+  QHash<int, QByteArray> FieldsPopupElementListModel::roleNames() const
+  {
+    return {
+      {LabelRole, "label"},
+      {FormattedValueRole, "formattedValue"}};
+  }
+
+  /*!
+    \brief Updates the model to the fields with \a labels and \a formattedValues.
+
+    Rows are compared with the fields they already show. Only rows whose label or value changed
+    emit \c dataChanged, and rows are inserted or removed at the end when the number of fields changes.
+   */
+  void FieldsPopupElementListModel::setFields(const QStringList& labels, const QStringList& formattedValues)
+  {
+    Q_ASSERT(labels.size() == formattedValues.size());
+
+    const auto count = std::min(labels.size(), formattedValues.size());
+    const auto sharedCount = std::min(count, m_labels.size());
+
+    for (qsizetype i = 0; i < sharedCount; ++i)
+    {
+      QList<int> changedRoles;
+      if (m_labels.at(i) != labels.at(i))
+      {
+        m_labels[i] = labels.at(i);
+        changedRoles.append(LabelRole);
+      }
+
+      if (m_formattedValues.at(i) != formattedValues.at(i))
+      {
+        m_formattedValues[i] = formattedValues.at(i);
+        changedRoles.append(FormattedValueRole);
+      }
+
+      if (!changedRoles.isEmpty())
+      {
+        const auto changedIndex = index(static_cast<int>(i));
+        emit dataChanged(changedIndex, changedIndex, changedRoles);
+      }
+    }
+
+    if (m_labels.size() > count)
+    {
+      beginRemoveRows(QModelIndex(), static_cast<int>(count), static_cast<int>(m_labels.size() - 1));
+      m_labels.resize(count);
+      m_formattedValues.resize(count);
+      endRemoveRows();
+    }
+    else if (count > m_labels.size())
+    {
+      beginInsertRows(QModelIndex(), static_cast<int>(m_labels.size()), static_cast<int>(count - 1));
+      m_labels.append(labels.mid(m_labels.size(), count - m_labels.size()));
+      m_formattedValues.append(formattedValues.mid(m_formattedValues.size(), count - m_formattedValues.size()));
+      endInsertRows();
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_FIELDSPOPUPELEMENTLISTMODEL_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_FIELDSPOPUPELEMENTLISTMODEL_H
+
+// Qt headers
+#include <QAbstractListModel>
+#include <QStringList>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class FieldsPopupElementListModel : public QAbstractListModel
+  {
+    Q_OBJECT
+
+  public:
+    explicit FieldsPopupElementListModel(QObject* parent = nullptr);
+    ~FieldsPopupElementListModel() override;
+
+    enum FieldRoles
+    {
+      LabelRole = Qt::UserRole + 1,
+      FormattedValueRole = Qt::UserRole + 2,
+    };
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    QHash<int, QByteArray> roleNames() const override;
+
+    void setFields(const QStringList& labels, const QStringList& formattedValues);
+
+  private:
+    QStringList m_labels;
+    QStringList m_formattedValues;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_FIELDSPOPUPELEMENTLISTMODEL_H
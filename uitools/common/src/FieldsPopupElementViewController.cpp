@@ -22,6 +22,7 @@
 #include <PopupField.h>
 
 // Toolkit headers
+#include "FieldsPopupElementListModel.h"
 #include "PopupViewController.h"
 
 namespace Esri::ArcGISRuntime::Toolkit
@@ -34,37 +35,42 @@ namespace Esri::ArcGISRuntime::Toolkit
   FieldsPopupElementViewController::FieldsPopupElementViewController(FieldsPopupElement* fieldsPopupElement,
                                                                      PopupViewController* popupViewController,
                                                                      QObject* parent) :
-    PopupElementViewItem{fieldsPopupElement, parent}
+    PopupElementViewItem{fieldsPopupElement, parent},
+    m_fields{new FieldsPopupElementListModel(this)}
   {
     // bubble up signal to PopupViewController
     connect(this, &FieldsPopupElementViewController::clickedUrl, popupViewController, &PopupViewController::clickedUrl);
+
+    connect(this, &PopupElementViewItem::popupElementChanged, this, &FieldsPopupElementViewController::updateFields);
+    connect(this, &FieldsPopupElementViewController::fieldsPopupElementChanged, this, &FieldsPopupElementViewController::updateFields);
+    updateFields();
   }
 
   FieldsPopupElementViewController::~FieldsPopupElementViewController() = default;
 
   QString FieldsPopupElementViewController::title() const
   {
-    const auto title = static_cast<FieldsPopupElement*>(popupElement())->title();
+    auto* fieldsPopupElement = static_cast<FieldsPopupElement*>(popupElement());
+    const auto title = fieldsPopupElement ? fieldsPopupElement->title() : QString{};
     return !title.isEmpty() ? title : QStringLiteral("Fields");
   }
 
-  QVariantList FieldsPopupElementViewController::labelsAndValues() const
+  /*!
+    \internal
+    Returns the labels and formatted values of the fields, which are updated in place when the element changes.
+   */
+  QAbstractListModel* FieldsPopupElementViewController::fields() const
   {
-    const auto list1 = static_cast<FieldsPopupElement*>(popupElement())->labels();
-    const auto list2 = static_cast<FieldsPopupElement*>(popupElement())->formattedValues();
-    QVariantList combinedData;
-
-    Q_ASSERT(list1.size() == list2.size());
+    return m_fields;
+  }
 
-    std::transform(list1.begin(), list1.end(), list2.begin(), std::back_inserter(combinedData), [](const QString& item1, const QString& item2)
+  void FieldsPopupElementViewController::updateFields()
+  {
+    // unbound while the controller waits to be recycled
+    if (auto* fieldsPopupElement = static_cast<FieldsPopupElement*>(popupElement()))
     {
-      QVariantMap item;
-      item["label"] = item1;
-      item["formattedValue"] = item2;
-      return item;
-    });
-
-    return combinedData;
+      m_fields->setFields(fieldsPopupElement->labels(), fieldsPopupElement->formattedValues());
+    }
   }
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -17,8 +17,8 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_FIELDSPOPUPELEMENTVIEWCONTROLLER_H
 
 // Qt headers
+#include <QAbstractListModel>
 #include <QObject>
-#include <QVariantList>
 
 // Other headers
 #include "PopupElementViewItem.h"
@@ -32,13 +32,14 @@ namespace Esri::ArcGISRuntime
   namespace Toolkit
   {
 
+    class FieldsPopupElementListModel;
     class PopupViewController;
 
     class FieldsPopupElementViewController : public PopupElementViewItem
     {
       Q_OBJECT
       Q_PROPERTY(QString title READ title NOTIFY fieldsPopupElementChanged)
-      Q_PROPERTY(QVariantList labelsAndValues READ labelsAndValues NOTIFY fieldsPopupElementChanged)
+      Q_PROPERTY(QAbstractListModel* fields READ fields CONSTANT)
 
     public:
       explicit FieldsPopupElementViewController(FieldsPopupElement* fieldsPopupElement,
@@ -47,11 +48,16 @@ namespace Esri::ArcGISRuntime
       ~FieldsPopupElementViewController() override;
 
       QString title() const;
-      QVariantList labelsAndValues() const;
+      QAbstractListModel* fields() const;
 
     signals:
       void fieldsPopupElementChanged();
       void clickedUrl(const QUrl& url);
+
+    private:
+      void updateFields();
+
+      FieldsPopupElementListModel* m_fields = nullptr;
     };
 
   } // namespace Toolkit
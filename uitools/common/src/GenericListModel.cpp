@@ -20,6 +20,7 @@
 
 #include <QMetaProperty>
 #include <QPointer>
+#include <QSet>
 
 namespace Esri::ArcGISRuntime::Toolkit
 {
@@ -230,6 +231,10 @@ namespace Esri::ArcGISRuntime::Toolkit
       auto p = property.read(o);
       return p;
     }
+    else if (role == ItemEnabledRole)
+    {
+      return flags(index).testFlag(Qt::ItemIsEnabled);
+    }
     else if (role == Qt::UserRole)
     {
       return QVariant::fromValue(o);
@@ -314,8 +319,9 @@ namespace Esri::ArcGISRuntime::Toolkit
   /*!
     \brief A collection of role names and the corresponding user role enum.
 
-    This will always return the hard-coded \e{(name, role)} combination
-    \c{(listModelData, Qt::UserRole)}.
+    This will always return the hard-coded \e{(name, role)} combinations
+    \c{(listModelData, Qt::UserRole)} and \c{(itemEnabled, ItemEnabledRole)}, the
+    latter being whether \l flags has \c Qt::ItemIsEnabled set for the row.
 
     For each subsequent property it will also expose:
     \c{(property_N, Qt::UserRole + N + 1)} where \tt{property_N} is the N\sup{th}
@@ -354,6 +360,7 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     QHash<int, QByteArray> output;
     output.insert(Qt::UserRole, "listModelData");
+    output.insert(ItemEnabledRole, "itemEnabled");
 
     const int offset = m_elementType->propertyOffset();
     for (int i = offset; i < m_elementType->propertyCount(); ++i)
@@ -467,19 +474,8 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
 
     beginRemoveRows(parent, row, row + count - 1);
-    for (int i = count - 1; i >= row; --i)
-    {
-      auto o = m_objects.at(i);
-
-      // Ensure additional removal signals are not triggered.
-      if (o && o->parent() == this)
-      {
-        disconnect(o, &QObject::destroyed, this, nullptr);
-        delete o;
-      }
-
-      m_objects.removeAt(i);
-    }
+    releaseObjects(m_objects.mid(row, count));
+    m_objects.remove(row, count);
     endRemoveRows();
     return true;
   }
@@ -498,15 +494,7 @@ namespace Esri::ArcGISRuntime::Toolkit
   void GenericListModel::setElementType(const QMetaObject* metaObject)
   {
     beginResetModel();
-    for (auto o : m_objects)
-    {
-      // Ensure additional removal signals are not triggered.
-      if (o && o->parent() == this)
-      {
-        disconnect(o, &QObject::destroyed, this, nullptr);
-        delete o;
-      }
-    }
+    releaseObjects(m_objects);
     m_objects.clear();
     m_elementType = metaObject;
     m_displayPropIndex = -1;
@@ -753,6 +741,46 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
   }
 
+  /*!
+    \internal
+    \brief Deletes the \a objects owned by this model, and stops tracking the others.
+
+    The MetaElements are looked up once for all of \a objects, so releasing many rows stays linear.
+   */
+  void GenericListModel::releaseObjects(const QList<QObject*>& objects)
+  {
+    QSet<QObject*> untrackedObjects;
+    for (auto o : objects)
+    {
+      // Ensure additional removal signals are not triggered.
+      if (o && o->parent() == this)
+      {
+        disconnect(o, &QObject::destroyed, this, nullptr);
+        delete o;
+      }
+      else if (o)
+      {
+        // The object outlives its row, so stop tracking it. It may be appended again later.
+        disconnect(o, nullptr, this, nullptr);
+        untrackedObjects.insert(o);
+      }
+    }
+
+    if (untrackedObjects.isEmpty())
+    {
+      return;
+    }
+
+    const auto metaElements = findChildren<MetaElement*>(Qt::FindDirectChildrenOnly);
+    for (auto* metaElement : metaElements)
+    {
+      if (untrackedObjects.contains(metaElement->trackedObject()))
+      {
+        delete metaElement;
+      }
+    }
+  }
+
   /*!
     \internal
     \brief Returns the size of the list for the count property.
@@ -32,6 +32,10 @@ namespace Esri::ArcGISRuntime::Toolkit
     Q_PROPERTY(int count READ count NOTIFY countChanged)
   public:
     typedef QFlags<Qt::ItemFlag>(FlagsCallback)(const QModelIndex& index);
+
+    // Whether flags() has Qt::ItemIsEnabled set for a row, so QML delegates follow the flags callback.
+    static constexpr int ItemEnabledRole = Qt::UserRole - 1;
+
     explicit Q_INVOKABLE GenericListModel(QObject* parent = nullptr);
 
     GenericListModel(const QMetaObject* elementType, QObject* parent = nullptr);
@@ -96,6 +100,7 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   private:
     void connectElement(QModelIndex index);
+    void releaseObjects(const QList<QObject*>& objects);
 
     int count() const;
 
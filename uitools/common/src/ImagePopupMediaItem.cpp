@@ -23,9 +23,37 @@
 #include <PopupMediaItem.h>
 #include <PopupViewController.h>
 
+// Qt headers
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
+  namespace
+  {
+    QNetworkAccessManager* networkAccessManager()
+    {
+      static QPointer<QNetworkAccessManager> manager;
+      if (!manager)
+      {
+        manager = new QNetworkAccessManager(QCoreApplication::instance());
+      }
+      return manager;
+    }
+
+    // Refreshes happen on multiples of the interval since the epoch, so items with the same
+    // interval refresh together instead of each on its own schedule.
+    int msecsUntilNextRefresh(quint64 interval)
+    {
+      const auto now = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch());
+      return static_cast<int>(interval - now % interval);
+    }
+  } // namespace
+
   /*!
     \internal
     This class is an internal implementation detail and is subject to change.
@@ -36,6 +64,14 @@ namespace Esri::ArcGISRuntime::Toolkit
     // bubble up imageClicked signal to PopupViewController. This is the sourceUrl & linkUrl used for ImagePopupMediaItems.
     connect(this, &ImagePopupMediaItem::imageClicked, popupViewController, &PopupViewController::imageClicked);
 
+    m_refreshTimer.setSingleShot(true);
+    m_refreshTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_refreshTimer, &QTimer::timeout, this, [this]()
+    {
+      setupRefreshTimer();
+      checkForUpdatedImage();
+    });
+
     setupRefreshTimer();
 
     connect(this, &ImagePopupMediaItem::imagePopupMediaItemChanged, this, &ImagePopupMediaItem::setupRefreshTimer);
@@ -47,21 +83,58 @@ namespace Esri::ArcGISRuntime::Toolkit
     {
       m_refreshTimer.stop();
     }
+
+    resetImageValidators();
+  }
+
+  void ImagePopupMediaItem::setPopupMedia(PopupMedia* popupMedia)
+  {
+    if (popupMedia == popupMediaItem())
+    {
+      return;
+    }
+
+    resetImageValidators();
+    PopupMediaItem::setPopupMedia(popupMedia);
+    emit imagePopupMediaItemChanged();
+  }
+
+  /*!
+    \internal
+    Returns whether the image is shown, which views set while the image is on screen. The image is only
+    refreshed while active. Defaults to \c false.
+   */
+  bool ImagePopupMediaItem::isActive() const
+  {
+    return m_isActive;
+  }
+
+  void ImagePopupMediaItem::setActive(bool active)
+  {
+    if (m_isActive == active)
+    {
+      return;
+    }
+
+    m_isActive = active;
+    setupRefreshTimer();
+    emit activeChanged();
   }
 
   QUrl ImagePopupMediaItem::sourceUrl() const
   {
-    return popupMediaItem()->value()->sourceUrl();
+    return popupMediaItem() ? popupMediaItem()->value()->sourceUrl() : QUrl{};
   }
 
   QUrl ImagePopupMediaItem::linkUrl() const
   {
-    return popupMediaItem()->value()->linkUrl();
+    return popupMediaItem() ? popupMediaItem()->value()->linkUrl() : QUrl{};
   }
 
   quint64 ImagePopupMediaItem::imageRefreshInterval() const
   {
-    return popupMediaItem()->imageRefreshInterval();
+    // an unbound item is never refreshed
+    return popupMediaItem() ? popupMediaItem()->imageRefreshInterval() : 0;
   }
 
   void ImagePopupMediaItem::setupRefreshTimer()
@@ -69,13 +142,87 @@ namespace Esri::ArcGISRuntime::Toolkit
     m_refreshTimer.stop();
 
     const quint64 interval = imageRefreshInterval();
-    if (interval > 0)
+    if (interval > 0 && m_isActive)
     {
-      m_refreshTimer.setInterval(static_cast<int>(interval));
-      m_refreshTimer.setSingleShot(false);
-      connect(&m_refreshTimer, &QTimer::timeout, this, &ImagePopupMediaItem::refreshImage, Qt::UniqueConnection);
-      m_refreshTimer.start();
+      m_refreshTimer.start(msecsUntilNextRefresh(interval));
     }
   }
 
+  /*!
+    \internal
+    Asks the server whether the image has changed since it was last shown, and emits \c refreshImage if so.
+
+    A conditional HEAD request is made with the validators of the last response, so unchanged images
+    are neither downloaded nor reloaded. Images whose server does not answer with validators, or which
+    cannot be checked, are always refreshed.
+   */
+  void ImagePopupMediaItem::checkForUpdatedImage()
+  {
+    if (m_validationReply || !popupMediaItem())
+    {
+      // the previous check is still in progress, or the item has been unbound
+      return;
+    }
+
+    const auto url = sourceUrl();
+    if (url.scheme() != QStringLiteral("http") && url.scheme() != QStringLiteral("https"))
+    {
+      emit refreshImage();
+      return;
+    }
+
+    QNetworkRequest request(url);
+    request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+    if (!m_entityTag.isEmpty())
+    {
+      request.setRawHeader("If-None-Match", m_entityTag);
+    }
+    if (!m_lastModified.isEmpty())
+    {
+      request.setRawHeader("If-Modified-Since", m_lastModified);
+    }
+
+    m_validationReply = networkAccessManager()->head(request);
+    connect(m_validationReply, &QNetworkReply::finished, this, [this, reply = m_validationReply.data()]()
+    {
+      reply->deleteLater();
+      if (reply != m_validationReply)
+      {
+        return;
+      }
+      m_validationReply.clear();
+
+      const auto status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+      if (status == 304)
+      {
+        return;
+      }
+
+      const auto entityTag = reply->rawHeader("ETag");
+      const auto lastModified = reply->rawHeader("Last-Modified");
+      const bool hasValidators = reply->error() == QNetworkReply::NoError && (!entityTag.isEmpty() || !lastModified.isEmpty());
+      if (hasValidators && entityTag == m_entityTag && lastModified == m_lastModified)
+      {
+        return;
+      }
+
+      m_entityTag = hasValidators ? entityTag : QByteArray{};
+      m_lastModified = hasValidators ? lastModified : QByteArray{};
+      emit refreshImage();
+    });
+  }
+
+  void ImagePopupMediaItem::resetImageValidators()
+  {
+    if (m_validationReply)
+    {
+      auto* reply = m_validationReply.data();
+      m_validationReply.clear();
+      reply->abort();
+    }
+
+    m_entityTag.clear();
+    m_lastModified.clear();
+  }
+
 } // namespace Esri::ArcGISRuntime::Toolkit
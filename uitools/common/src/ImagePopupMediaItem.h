@@ -17,13 +17,17 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_IMAGEPOPUPMEDIAITEM_H
 
 // Qt headers
+#include <QByteArray>
 #include <QJsonObject>
 #include <QObject>
+#include <QPointer>
 #include <QTimer>
 
 // Other headers
 #include "PopupMediaItem.h"
 
+class QNetworkReply;
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
@@ -35,23 +39,38 @@ namespace Esri::ArcGISRuntime::Toolkit
     Q_PROPERTY(QUrl sourceUrl READ sourceUrl NOTIFY imagePopupMediaItemChanged)
     Q_PROPERTY(QUrl linkUrl READ linkUrl NOTIFY imagePopupMediaItemChanged)
     Q_PROPERTY(quint64 imageRefreshInterval READ imageRefreshInterval NOTIFY imagePopupMediaItemChanged)
+    Q_PROPERTY(bool active READ isActive WRITE setActive NOTIFY activeChanged)
 
   public:
     explicit ImagePopupMediaItem(PopupMedia* popupMedia, PopupViewController* popupViewController, QObject* parent = nullptr);
     ~ImagePopupMediaItem() override;
 
+    void setPopupMedia(PopupMedia* popupMedia) override;
+
+    bool isActive() const;
+    void setActive(bool active);
+
   private:
     QUrl linkUrl() const;
     QUrl sourceUrl() const;
     quint64 imageRefreshInterval() const;
 
     void setupRefreshTimer();
+    void checkForUpdatedImage();
+    void resetImageValidators();
+
     QTimer m_refreshTimer;
+    bool m_isActive = false;
+    // validators of the image last shown, compared by conditional requests before each refresh
+    QByteArray m_entityTag;
+    QByteArray m_lastModified;
+    QPointer<QNetworkReply> m_validationReply;
 
   signals:
     void imagePopupMediaItemChanged();
     void imageClicked(const QUrl& sourceUrl, const QUrl& linkUrl);
     void refreshImage();
+    void activeChanged();
   };
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -19,6 +19,10 @@
 // Qt headers
 #include <QPointF>
 
+// std headers
+#include <algorithm>
+#include <cmath>
+
 // Maps SDK headers
 #include <PopupMedia.h>
 #include <PopupMediaValue.h>
@@ -29,6 +33,69 @@
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
+  namespace
+  {
+    /*!
+      \internal
+      Reduces \a points to \a threshold points with the Largest-Triangle-Three-Buckets algorithm,
+      which keeps the first and last points and, from each bucket in between, the point forming
+      the largest triangle with its neighbours, so peaks and troughs survive.
+     */
+    QList<QPointF> largestTriangleThreeBuckets(const QList<QPointF>& points, int threshold)
+    {
+      const auto count = points.size();
+      if (threshold >= count || threshold < 3)
+      {
+        return points;
+      }
+
+      QList<QPointF> sampled;
+      sampled.reserve(threshold);
+      sampled.append(points.first());
+
+      const double bucketSize = static_cast<double>(count - 2) / (threshold - 2);
+      qsizetype selected = 0;
+
+      for (int bucket = 0; bucket < threshold - 2; ++bucket)
+      {
+        // the average of the next bucket stands in for the third point
+        const auto nextStart = static_cast<qsizetype>((bucket + 1) * bucketSize) + 1;
+        const auto nextEnd = std::min(static_cast<qsizetype>((bucket + 2) * bucketSize) + 1, count);
+        QPointF average;
+        for (auto i = nextStart; i < nextEnd; ++i)
+        {
+          average += points.at(i);
+        }
+        if (nextEnd > nextStart)
+        {
+          average /= static_cast<qreal>(nextEnd - nextStart);
+        }
+
+        const auto start = static_cast<qsizetype>(bucket * bucketSize) + 1;
+        const auto end = static_cast<qsizetype>((bucket + 1) * bucketSize) + 1;
+        const auto& a = points.at(selected);
+        qreal maximumArea = -1.0;
+        auto next = start;
+        for (auto i = start; i < end; ++i)
+        {
+          const auto& b = points.at(i);
+          const auto area = std::abs((a.x() - average.x()) * (b.y() - a.y()) - (a.x() - b.x()) * (average.y() - a.y()));
+          if (area > maximumArea)
+          {
+            maximumArea = area;
+            next = i;
+          }
+        }
+
+        sampled.append(points.at(next));
+        selected = next;
+      }
+
+      sampled.append(points.last());
+      return sampled;
+    }
+  } // namespace
+
   /*!
     \internal
     This class is an internal implementation detail and is subject to change.
@@ -36,14 +103,50 @@ namespace Esri::ArcGISRuntime::Toolkit
   LineChartPopupMediaItem::LineChartPopupMediaItem(PopupMedia* popupMedia, QObject* parent) :
     PopupMediaItem{popupMedia, parent}
   {
+    updateValues();
+  }
+
+  LineChartPopupMediaItem::~LineChartPopupMediaItem() = default;
+
+  void LineChartPopupMediaItem::setPopupMedia(PopupMedia* popupMedia)
+  {
+    if (popupMedia == popupMediaItem())
+    {
+      return;
+    }
+
+    PopupMediaItem::setPopupMedia(popupMedia);
+    updateValues();
+    emit lineChartPopupMediaItemChanged();
+  }
+
+  void LineChartPopupMediaItem::updateValues()
+  {
+    m_linePoints.clear();
+    m_points.clear();
+    m_downsampledPoints.clear();
+    m_downsampledWidth = -1;
+    m_color = QColor();
+    m_maxValue = 0.0;
+    m_minValue = 0.0;
+
+    if (!popupMediaItem())
+    {
+      // unbound while pooled
+      return;
+    }
+
+    // the media value is read once, the lists it returns are copies
     auto mediaValue = popupMediaItem()->value();
-    const auto popupMediaValueDataLength = mediaValue->data().length();
+    const auto data = mediaValue->data();
+    const auto popupMediaValueDataLength = data.length();
     const auto chartColors = mediaValue->chartColors();
 
+    m_points.reserve(popupMediaValueDataLength);
+    m_linePoints.reserve(popupMediaValueDataLength);
     for (int i = 0; i < popupMediaValueDataLength; i++)
     {
-      const auto label = mediaValue->labels().at(i);
-      const auto value = mediaValue->data().at(i).toReal();
+      const auto value = data.at(i).toReal();
 
       if (value >= m_maxValue)
       {
@@ -56,22 +159,51 @@ namespace Esri::ArcGISRuntime::Toolkit
       }
 
       const auto point = QPointF(i, value);
+      m_points.append(point);
       m_linePoints.append(point);
     }
 
+    m_chartColorsEmpty = chartColors.isEmpty();
     if (!chartColors.isEmpty())
     {
       m_color = chartColors.at(0);
     }
   }
 
-  LineChartPopupMediaItem::~LineChartPopupMediaItem() = default;
-
   QVariantList LineChartPopupMediaItem::linePoints() const
   {
     return m_linePoints;
   }
 
+  /*!
+    \internal
+    Returns the points of the line downsampled to at most one per pixel of a chart \a width pixels wide.
+
+    The points keep their index along the x axis, so the axis range is \l pointCount whatever the width.
+    The result for the last width asked for is cached.
+   */
+  QVariantList LineChartPopupMediaItem::linePointsForWidth(int width)
+  {
+    if (width <= 0 || width >= m_points.size())
+    {
+      return m_linePoints;
+    }
+
+    if (width != m_downsampledWidth)
+    {
+      const auto sampled = largestTriangleThreeBuckets(m_points, width);
+      m_downsampledPoints.clear();
+      m_downsampledPoints.reserve(sampled.size());
+      for (const auto& point : sampled)
+      {
+        m_downsampledPoints.append(point);
+      }
+      m_downsampledWidth = width;
+    }
+
+    return m_downsampledPoints;
+  }
+
   QColor LineChartPopupMediaItem::color() const
   {
     return m_color;
@@ -89,7 +221,12 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   bool LineChartPopupMediaItem::chartColorsEmpty() const
   {
-    return popupMediaItem()->value()->chartColors().isEmpty();
+    return m_chartColorsEmpty;
+  }
+
+  int LineChartPopupMediaItem::pointCount() const
+  {
+    return static_cast<int>(m_points.size());
   }
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -19,6 +19,7 @@
 // Qt headers
 #include <QColor>
 #include <QJsonArray>
+#include <QList>
 #include <QObject>
 #include <QPointF>
 #include <QVariant>
@@ -37,23 +38,35 @@ namespace Esri::ArcGISRuntime::Toolkit
     Q_PROPERTY(qreal maxValue READ maxValue NOTIFY lineChartPopupMediaItemChanged)
     Q_PROPERTY(qreal minValue READ minValue NOTIFY lineChartPopupMediaItemChanged)
     Q_PROPERTY(bool chartColorsEmpty READ chartColorsEmpty NOTIFY lineChartPopupMediaItemChanged)
+    Q_PROPERTY(int pointCount READ pointCount NOTIFY lineChartPopupMediaItemChanged)
 
   public:
     explicit LineChartPopupMediaItem(PopupMedia* popupMedia, QObject* parent = nullptr);
     ~LineChartPopupMediaItem() override;
 
+    void setPopupMedia(PopupMedia* popupMedia) override;
+
+    Q_INVOKABLE QVariantList linePointsForWidth(int width);
+
   private:
     QVariantList linePoints() const;
     QColor color() const;
     qreal maxValue() const;
     qreal minValue() const;
     bool chartColorsEmpty() const;
+    int pointCount() const;
+    void updateValues();
 
   signals:
     void lineChartPopupMediaItemChanged();
 
   private:
     QVariantList m_linePoints;
+    QList<QPointF> m_points;
+    // the points last downsampled, for m_downsampledWidth
+    QVariantList m_downsampledPoints;
+    int m_downsampledWidth = -1;
+    bool m_chartColorsEmpty = true;
     QColor m_color;
     qreal m_maxValue = 0.0;
     qreal m_minValue = 0.0;
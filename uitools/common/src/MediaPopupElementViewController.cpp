@@ -30,9 +30,60 @@
 #include <PopupMediaItem.h>
 #include <PopupViewController.h>
 
+// Qt headers
+#include <QMultiHash>
+
+// std headers
+#include <algorithm>
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
+  namespace
+  {
+    // The class of item displaying media of type \a popupMediaType, or nullptr if the type is not supported.
+    const QMetaObject* itemTypeForMediaType(PopupMediaType popupMediaType)
+    {
+      switch (popupMediaType)
+      {
+        case PopupMediaType::Image:
+          return &ImagePopupMediaItem::staticMetaObject;
+        case PopupMediaType::BarChart:
+          [[fallthrough]];
+        case PopupMediaType::ColumnChart:
+          return &BarChartPopupMediaItem::staticMetaObject;
+        case PopupMediaType::PieChart:
+          return &PieChartPopupMediaItem::staticMetaObject;
+        case PopupMediaType::LineChart:
+          return &LineChartPopupMediaItem::staticMetaObject;
+        case PopupMediaType::Unknown:
+          Q_UNIMPLEMENTED();
+          break;
+      }
+      return nullptr;
+    }
+
+    PopupMediaItem* createPopupMediaItem(PopupMedia* popupMedia, PopupViewController* popupViewController, QObject* parent)
+    {
+      switch (popupMedia->popupMediaType())
+      {
+        case PopupMediaType::Image:
+          return new ImagePopupMediaItem(popupMedia, popupViewController, parent);
+        case PopupMediaType::BarChart:
+          [[fallthrough]];
+        case PopupMediaType::ColumnChart:
+          return new BarChartPopupMediaItem(popupMedia, parent);
+        case PopupMediaType::PieChart:
+          return new PieChartPopupMediaItem(popupMedia, parent);
+        case PopupMediaType::LineChart:
+          return new LineChartPopupMediaItem(popupMedia, parent);
+        case PopupMediaType::Unknown:
+          break;
+      }
+      return nullptr;
+    }
+  } // namespace
+
   /*!
     \internal
     This class is an internal implementation detail and is subject to change.
@@ -41,49 +92,130 @@ namespace Esri::ArcGISRuntime::Toolkit
                                                                    PopupViewController* popupViewController,
                                                                    QObject* parent) :
     PopupElementViewItem{mediaPopupElement, parent},
-    m_popupMediaItems{new GenericListModel(&PopupMediaItem::staticMetaObject, this)}
+    m_popupMediaItems{new GenericListModel(&PopupMediaItem::staticMetaObject, this)},
+    m_popupViewController{popupViewController}
   {
+    updatePopupMediaItems();
+  }
+
+  MediaPopupElementViewController::~MediaPopupElementViewController() = default;
+
+  /*!
+    \internal
+    Rebinds this controller to \a popupElement, recycling the media items already created.
+   */
+  void MediaPopupElementViewController::setPopupElement(PopupElement* popupElement)
+  {
+    if (popupElement == this->popupElement())
+    {
+      return;
+    }
+
+    PopupElementViewItem::setPopupElement(popupElement);
+    updatePopupMediaItems();
+    emit mediaPopupElementChanged();
+  }
+
+  void MediaPopupElementViewController::updatePopupMediaItems()
+  {
+    auto* mediaPopupElement = static_cast<MediaPopupElement*>(popupElement());
+    if (!mediaPopupElement)
+    {
+      // pooled, so the items must not keep the media of the previous popup, which may be deleted with it
+      for (int i = 0; i < m_popupMediaItems->rowCount(); i++)
+      {
+        m_popupMediaItems->element<PopupMediaItem>(m_popupMediaItems->index(i))->setPopupMedia(nullptr);
+      }
+      return;
+    }
+
+    QList<PopupMedia*> mediaList;
     auto* media = mediaPopupElement->media();
-    const auto mediaListModelSize = media->size();
+    for (int i = 0; i < media->size(); i++)
+    {
+      if (itemTypeForMediaType(media->at(i)->popupMediaType()))
+      {
+        mediaList.append(media->at(i));
+      }
+    }
 
-    for (int i = 0; i < mediaListModelSize; i++)
+    // the items are owned by the model, so rows removed from it are deleted
+    QList<PopupMediaItem*> items;
+    const auto itemCount = m_popupMediaItems->rowCount();
+    items.reserve(itemCount);
+    for (int i = 0; i < itemCount; i++)
     {
-      auto* popupMedia = media->at(i);
-      const auto popupMediaType = popupMedia->popupMediaType();
+      items.append(m_popupMediaItems->element<PopupMediaItem>(m_popupMediaItems->index(i)));
+    }
 
-      switch (popupMediaType)
+    // Chart delegates only build their series when they are created, so a chart item is never rebound
+    // under an existing delegate. Its row is recreated instead, by handing the items out again below.
+    const auto reusedCount = std::min(items.size(), mediaList.size());
+    const bool canRebindInPlace = std::equal(items.cbegin(), items.cbegin() + reusedCount, mediaList.cbegin(),
+                                             [](PopupMediaItem* item, PopupMedia* popupMedia)
+    {
+      return item->metaObject() == &ImagePopupMediaItem::staticMetaObject &&
+             item->metaObject() == itemTypeForMediaType(popupMedia->popupMediaType());
+    });
+
+    if (canRebindInPlace)
+    {
+      // rows keep their item, only the difference in length is created or removed
+      for (qsizetype i = 0; i < reusedCount; i++)
       {
-        case Esri::ArcGISRuntime::PopupMediaType::Image:
-          m_popupMediaItems->append(new ImagePopupMediaItem(popupMedia, popupViewController, media));
-          break;
-        case Esri::ArcGISRuntime::PopupMediaType::BarChart:
-          [[fallthrough]];
-        case Esri::ArcGISRuntime::PopupMediaType::ColumnChart:
-          m_popupMediaItems->append(new BarChartPopupMediaItem(popupMedia, media));
-          break;
-        case Esri::ArcGISRuntime::PopupMediaType::PieChart:
-          m_popupMediaItems->append(new PieChartPopupMediaItem(popupMedia, media));
-          break;
-        case Esri::ArcGISRuntime::PopupMediaType::LineChart:
-          m_popupMediaItems->append(new LineChartPopupMediaItem(popupMedia, media));
-          break;
-        case Esri::ArcGISRuntime::PopupMediaType::Unknown:
-          Q_UNIMPLEMENTED();
-          break;
+        items.at(i)->setPopupMedia(mediaList.at(i));
+      }
+
+      if (items.size() > reusedCount)
+      {
+        m_popupMediaItems->removeRows(static_cast<int>(reusedCount), static_cast<int>(items.size() - reusedCount));
+      }
+
+      for (qsizetype i = reusedCount; i < mediaList.size(); i++)
+      {
+        m_popupMediaItems->append(createPopupMediaItem(mediaList.at(i), m_popupViewController, m_popupMediaItems));
       }
+      return;
     }
-  }
 
-  MediaPopupElementViewController::~MediaPopupElementViewController() = default;
+    // the kinds of media have changed order or include charts, so the items are pooled by class and
+    // handed out again in new rows
+    QMultiHash<const QMetaObject*, PopupMediaItem*> recycledItems;
+    for (auto* item : std::as_const(items))
+    {
+      item->setParent(this);
+      recycledItems.insert(item->metaObject(), item);
+    }
+    m_popupMediaItems->clear();
+
+    for (auto* popupMedia : std::as_const(mediaList))
+    {
+      auto* item = recycledItems.take(itemTypeForMediaType(popupMedia->popupMediaType()));
+      if (item)
+      {
+        item->setParent(m_popupMediaItems);
+        item->setPopupMedia(popupMedia);
+      }
+      else
+      {
+        item = createPopupMediaItem(popupMedia, m_popupViewController, m_popupMediaItems);
+      }
+      m_popupMediaItems->append(item);
+    }
+
+    qDeleteAll(recycledItems);
+  }
 
   QString MediaPopupElementViewController::description() const
   {
-    return static_cast<MediaPopupElement*>(popupElement())->description();
+    auto* mediaPopupElement = static_cast<MediaPopupElement*>(popupElement());
+    return mediaPopupElement ? mediaPopupElement->description() : QString{};
   }
 
   QString MediaPopupElementViewController::title() const
   {
-    auto title = static_cast<MediaPopupElement*>(popupElement())->title();
+    auto* mediaPopupElement = static_cast<MediaPopupElement*>(popupElement());
+    const auto title = mediaPopupElement ? mediaPopupElement->title() : QString{};
     return !title.isEmpty() ? title : QStringLiteral("Media");
   }
 
@@ -48,6 +48,8 @@ namespace Esri::ArcGISRuntime
                                                QObject* parent = nullptr);
       ~MediaPopupElementViewController() override;
 
+      void setPopupElement(PopupElement* popupElement) override;
+
       QString description() const;
       QString title() const;
       GenericListModel* popupMediaItems() const;
@@ -56,7 +58,10 @@ namespace Esri::ArcGISRuntime
       void mediaPopupElementChanged();
 
     private:
+      void updatePopupMediaItems();
+
       GenericListModel* m_popupMediaItems = nullptr;
+      PopupViewController* m_popupViewController = nullptr;
     };
 
   } // namespace Toolkit
@@ -69,6 +69,14 @@ namespace Esri::ArcGISRuntime::Toolkit
     connect(m_trackedObject.data(), &QObject::destroyed, this, &QObject::deleteLater);
   }
 
+  /*!
+    \brief Returns the element in the GenericListModel this is tracking.
+   */
+  QObject* MetaElement::trackedObject() const
+  {
+    return m_trackedObject;
+  }
+
   /*!
     \brief When triggered will emit a dataChangedSignal on the parent
     GenericListModel using the stored index and role as cues.
@@ -32,6 +32,8 @@ namespace Esri::ArcGISRuntime::Toolkit
   public:
     MetaElement(QModelIndex index, int customRole, QObject* trackedObject, QAbstractItemModel* parent);
 
+    QObject* trackedObject() const;
+
   signals:
     void propertyChanged();
 
@@ -19,11 +19,14 @@
 #endif
 #include "OverviewMapController.h"
 
+#include "OverviewMapStaticInset.h"
 #include "SingleShotConnection.h"
 
 // ArcGISRuntime headers
+#include <Envelope.h>
 #include <Error.h>
 #include <Geometry.h>
+#include <GeometryEngine.h>
 #include <Graphic.h>
 #include <GraphicListModel.h>
 #include <GraphicsOverlay.h>
@@ -37,11 +40,14 @@
 #include <SimpleFillSymbol.h>
 #include <SimpleLineSymbol.h>
 #include <SimpleMarkerSymbol.h>
+#include <SpatialReference.h>
 #include <SymbolTypes.h>
 #include <Viewpoint.h>
 
 // Qt headers
+#include <QGuiApplication>
 #include <QKeyEvent>
+#include <QScreen>
 #include <QtGlobal>
 
 namespace Esri::ArcGISRuntime::Toolkit
@@ -57,15 +63,36 @@ namespace Esri::ArcGISRuntime::Toolkit
     m_insetView(new MapViewToolkit),
     m_reticle(new Graphic(this))
   {
+    // At most one viewpoint update is in flight per direction. Viewpoints requested meanwhile
+    // replace each other, and only the latest is applied once the update in flight finishes.
     connect(&m_setViewpointWatcher, &QFutureWatcher<bool>::finished, this, [this]
     {
-      m_isUpdatingGeoViewFromInset = false;
+      if (m_pendingGeoViewViewpoint.isEmpty())
+      {
+        m_isUpdatingGeoViewFromInset = false;
+        return;
+      }
+
+      const auto viewpoint = m_pendingGeoViewViewpoint;
+      m_pendingGeoViewViewpoint = Viewpoint{};
+      startGeoViewNavigationUpdate(viewpoint);
     });
     connect(&m_setViewpointInsetWatcher, &QFutureWatcher<bool>::finished, this, [this]
     {
-      m_isUpdatingInsetFromGeoView = false;
+      if (m_pendingInsetViewpoint.isEmpty())
+      {
+        m_isUpdatingInsetFromGeoView = false;
+        return;
+      }
+
+      const auto viewpoint = m_pendingInsetViewpoint;
+      m_pendingInsetViewpoint = Viewpoint{};
+      startInsetNavigationUpdate(viewpoint);
     });
 
+    m_reticleUpdateTimer.setSingleShot(true);
+    connect(&m_reticleUpdateTimer, &QTimer::timeout, this, &OverviewMapController::updateReticle);
+
     m_insetView->setAttributionTextVisible(false);
 
     // Disable keyboard interactions, and mouse
@@ -82,19 +109,19 @@ namespace Esri::ArcGISRuntime::Toolkit
     // to the main GeoView if applicable.
     connect(m_insetView, &MapViewToolkit::viewpointChanged, this, [this]
     {
-      if (m_insetView->isNavigating() && !m_isUpdatingInsetFromGeoView)
+      if (m_insetView->isNavigating() && !m_isUpdatingInsetFromGeoView && !m_isStaticInset)
       {
-        if (auto* sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+        if (qobject_cast<SceneViewToolkit*>(m_geoView))
         {
-          applyInsetNavigationToSceneView(sceneView);
+          applyInsetNavigationToSceneView();
         }
-        else if (auto* localSceneView = qobject_cast<LocalSceneViewToolkit*>(m_geoView))
+        else if (qobject_cast<LocalSceneViewToolkit*>(m_geoView))
         {
-          applyInsetNavigationToLocalSceneView(localSceneView);
+          applyInsetNavigationToLocalSceneView();
         }
-        else if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+        else if (qobject_cast<MapViewToolkit*>(m_geoView))
         {
-          applyInsetNavigationToMapView(mapView);
+          applyInsetNavigationToMapView();
         }
       }
     });
@@ -154,8 +181,7 @@ namespace Esri::ArcGISRuntime::Toolkit
       // Connect to geoViews's viewpointChanged. Updates insetView when the SceneView-geoView viewpoint changes.
       QObject::connect(sceneView, &SceneViewToolkit::viewpointChanged, this, [this, sceneView]
       {
-        const Viewpoint viewpoint = sceneView->currentViewpoint(ViewpointType::CenterAndScale);
-        m_reticle->setGeometry(viewpoint.targetGeometry());
+        scheduleReticleUpdate();
         if (sceneView->isNavigating() && !m_isUpdatingGeoViewFromInset)
         {
           applySceneNavigationToInset(sceneView);
@@ -198,8 +224,7 @@ namespace Esri::ArcGISRuntime::Toolkit
       // Connect to geoViews's viewpointChanged. Updates insetView when the SceneView-geoView viewpoint changes.
       QObject::connect(localSceneView, &LocalSceneViewToolkit::viewpointChanged, this, [this, localSceneView]
       {
-        const Viewpoint viewpoint = localSceneView->currentViewpoint(ViewpointType::CenterAndScale);
-        m_reticle->setGeometry(viewpoint.targetGeometry());
+        scheduleReticleUpdate();
         if (localSceneView->isNavigating() && !m_isUpdatingGeoViewFromInset)
         {
           applyLocalSceneNavigationToInset(localSceneView);
@@ -245,7 +270,7 @@ namespace Esri::ArcGISRuntime::Toolkit
       // Connect to geoView's viewpointChanged. Updates insetView when MapView-geoView viewpoint changes.
       QObject::connect(mapView, &MapViewToolkit::viewpointChanged, this, [this, mapView]
       {
-        m_reticle->setGeometry(mapView->visibleArea());
+        scheduleReticleUpdate();
         if (mapView->isNavigating() && !m_isUpdatingGeoViewFromInset)
         {
           applyMapNavigationToInset(mapView);
@@ -320,52 +345,259 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
   }
 
+  /*!
+    \internal
+    \brief Returns \c true if the inset is drawn from cached rasters of its basemap instead of a live map.
+
+    The rasters are exported from a live inset map the first time the region they cover is needed and
+    cached to disk. The inset map is released while no rasters are missing, and only the reticle is
+    drawn as the geoView navigates.
+    Defaults to \c false.
+   */
+  bool OverviewMapController::isStaticInset() const
+  {
+    return m_isStaticInset;
+  }
+
+  void OverviewMapController::setStaticInset(bool staticInset)
+  {
+    if (m_isStaticInset == staticInset)
+    {
+      return;
+    }
+
+    m_isStaticInset = staticInset;
+
+    if (m_isStaticInset)
+    {
+      if (!m_staticInset)
+      {
+        m_staticInset = new OverviewMapStaticInset(OverviewMapStaticInset::defaultDirectory(), this);
+        connect(m_staticInset, &OverviewMapStaticInset::generatingChanged, this, [this]
+        {
+          if (!m_isStaticInset || m_staticInset->isGenerating())
+          {
+            return;
+          }
+
+          // the live map stays as a fallback only if the world raster could not be exported
+          if (m_staticInset->isReady())
+          {
+            releaseInsetMap();
+          }
+          updateReticle();
+        });
+      }
+
+      // exported from the live map if there already is one, otherwise once it is set up
+      generateStaticInset();
+    }
+    else
+    {
+      m_staticInsetImage.clear();
+      m_staticInsetReticle.clear();
+      emit staticInsetReticleChanged();
+
+      if (!m_insetView->map())
+      {
+        setupInsetMap();
+      }
+    }
+
+    emit staticInsetChanged();
+    updateReticle();
+  }
+
+  /*!
+    \internal
+    \brief Returns the cached raster the static inset is drawn from, or an empty url while there is none.
+   */
+  QUrl OverviewMapController::staticInsetImage() const
+  {
+    return m_staticInsetImage;
+  }
+
+  /*!
+    \internal
+    \brief Returns the rings of the reticle in the static inset, as lists of points normalized to \l staticInsetImage.
+   */
+  QVariantList OverviewMapController::staticInsetReticle() const
+  {
+    return m_staticInsetReticle;
+  }
+
+  /*!
+    \internal
+    \brief Returns \c true while the inset view has a live map.
+
+    In static mode this is only the case while rasters are being exported from it, or if the world
+    raster could not be exported. It has to stay visible beneath the static inset meanwhile so it draws.
+   */
+  bool OverviewMapController::isLiveInset() const
+  {
+    return m_insetView->map() != nullptr;
+  }
+
   void OverviewMapController::resetNavigationSynchronization()
   {
     m_isUpdatingGeoViewFromInset = false;
     m_isUpdatingInsetFromGeoView = false;
+    m_pendingGeoViewViewpoint = Viewpoint{};
+    m_pendingInsetViewpoint = Viewpoint{};
+  }
+
+  void OverviewMapController::requestGeoViewNavigationUpdate(const Viewpoint& viewpoint)
+  {
+    if (m_isUpdatingGeoViewFromInset)
+    {
+      // superseded viewpoints are never applied
+      m_pendingGeoViewViewpoint = viewpoint;
+      return;
+    }
+
+    startGeoViewNavigationUpdate(viewpoint);
+  }
+
+  void OverviewMapController::requestInsetNavigationUpdate(const Viewpoint& viewpoint)
+  {
+    if (m_isStaticInset)
+    {
+      // the static inset does not follow the geoView, only its reticle does
+      return;
+    }
+
+    if (m_isUpdatingInsetFromGeoView)
+    {
+      // superseded viewpoints are never applied
+      m_pendingInsetViewpoint = viewpoint;
+      return;
+    }
+
+    startInsetNavigationUpdate(viewpoint);
   }
 
-  void OverviewMapController::startGeoViewNavigationUpdate(const QFuture<bool>& future)
+  void OverviewMapController::startGeoViewNavigationUpdate(const Viewpoint& viewpoint)
   {
+    constexpr float animationDuration{0};
+    QFuture<bool> future;
+    if (auto* sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+    {
+      future = sceneView->setViewpointAsync(viewpoint, animationDuration);
+    }
+    else if (auto* localSceneView = qobject_cast<LocalSceneViewToolkit*>(m_geoView))
+    {
+      future = localSceneView->setViewpointAsync(viewpoint, animationDuration);
+    }
+    else if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    {
+      future = mapView->setViewpointAsync(viewpoint, animationDuration);
+    }
+    else
+    {
+      m_isUpdatingGeoViewFromInset = false;
+      return;
+    }
+
     m_isUpdatingGeoViewFromInset = true;
     m_setViewpointWatcher.setFuture(future);
   }
 
-  void OverviewMapController::startInsetNavigationUpdate(const QFuture<bool>& future)
+  void OverviewMapController::startInsetNavigationUpdate(const Viewpoint& viewpoint)
   {
+    constexpr float animationDuration{0};
     m_isUpdatingInsetFromGeoView = true;
-    m_setViewpointInsetWatcher.setFuture(future);
+    m_setViewpointInsetWatcher.setFuture(m_insetView->setViewpointAsync(viewpoint, animationDuration));
   }
 
-  void OverviewMapController::applyInsetNavigationToMapView(MapViewToolkit* view)
+  /*!
+    \internal
+    \brief Updates the reticle on the next frame, so continuous navigation updates it at most once per frame.
+   */
+  void OverviewMapController::scheduleReticleUpdate()
+  {
+    if (m_reticleUpdateTimer.isActive())
+    {
+      return;
+    }
+
+    const auto* screen = QGuiApplication::primaryScreen();
+    const auto refreshRate = screen && screen->refreshRate() > 0 ? screen->refreshRate() : 60.0;
+    m_reticleUpdateTimer.start(static_cast<int>(1000.0 / refreshRate));
+  }
+
+  void OverviewMapController::updateReticle()
+  {
+    if (auto* sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+    {
+      m_reticle->setGeometry(sceneView->currentViewpoint(ViewpointType::CenterAndScale).targetGeometry());
+    }
+    else if (auto* localSceneView = qobject_cast<LocalSceneViewToolkit*>(m_geoView))
+    {
+      m_reticle->setGeometry(localSceneView->currentViewpoint(ViewpointType::CenterAndScale).targetGeometry());
+    }
+    else if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    {
+      m_reticle->setGeometry(mapView->visibleArea());
+    }
+
+    if (m_isStaticInset)
+    {
+      updateStaticInsetReticle();
+    }
+  }
+
+  void OverviewMapController::updateStaticInsetReticle()
+  {
+    const auto geometry = m_reticle->geometry();
+    const auto webMercator = SpatialReference::webMercator();
+    const auto projected = geometry.isEmpty() || geometry.spatialReference() == webMercator ? geometry : GeometryEngine::project(geometry, webMercator);
+
+    if (!isStaticInsetReady() || projected.isEmpty())
+    {
+      return;
+    }
+
+    // the extent the live inset would show, at the geoView's scale times scaleFactor around the
+    // reticle, which is only a point for scenes
+    constexpr double metersPerPixel = 0.0254 / 96.0;
+    const auto insetScale = geoViewScale() * scaleFactor();
+    const auto center = projected.extent().center();
+    const auto halfWidth = insetScale * static_cast<double>(m_insetView->width()) * metersPerPixel / 2.0;
+    const auto halfHeight = insetScale * static_cast<double>(m_insetView->height()) * metersPerPixel / 2.0;
+    const Envelope insetExtent(center.x() - halfWidth, center.y() - halfHeight, center.x() + halfWidth, center.y() + halfHeight, webMercator);
+
+    const auto raster = m_staticInset->rasterFor(insetExtent);
+
+    m_staticInsetImage = QUrl::fromLocalFile(raster.filePath);
+    m_staticInsetReticle = OverviewMapStaticInset::reticle(projected, raster.extent);
+    emit staticInsetReticleChanged();
+  }
+
+  void OverviewMapController::applyInsetNavigationToMapView()
   {
     // Note we care about rotation in the mapView case.
     const Viewpoint viewpoint = m_insetView->currentViewpoint(ViewpointType::CenterAndScale);
     const Viewpoint newViewpoint{geometry_cast<Point>(viewpoint.targetGeometry()), viewpoint.targetScale() / scaleFactor(), viewpoint.rotation()};
 
-    constexpr float animationDuration{0};
-    startGeoViewNavigationUpdate(view->setViewpointAsync(newViewpoint, animationDuration));
+    requestGeoViewNavigationUpdate(newViewpoint);
   }
 
-  void OverviewMapController::applyInsetNavigationToSceneView(SceneViewToolkit* view)
+  void OverviewMapController::applyInsetNavigationToSceneView()
   {
     // Note we do not care about rotation in the sceneView case.
     const Viewpoint viewpoint = m_insetView->currentViewpoint(ViewpointType::CenterAndScale);
     const Viewpoint newViewpoint{geometry_cast<Point>(viewpoint.targetGeometry()), viewpoint.targetScale() / scaleFactor()};
 
-    constexpr float animationDuration{0};
-    startGeoViewNavigationUpdate(view->setViewpointAsync(newViewpoint, animationDuration));
+    requestGeoViewNavigationUpdate(newViewpoint);
   }
 
-  void OverviewMapController::applyInsetNavigationToLocalSceneView(LocalSceneViewToolkit* view)
+  void OverviewMapController::applyInsetNavigationToLocalSceneView()
   {
     // Note we do not care about rotation in the sceneView case.
     const Viewpoint viewpoint = m_insetView->currentViewpoint(ViewpointType::CenterAndScale);
     const Viewpoint newViewpoint{geometry_cast<Point>(viewpoint.targetGeometry()), viewpoint.targetScale() / scaleFactor()};
 
-    constexpr float animationDuration{0};
-    startGeoViewNavigationUpdate(view->setViewpointAsync(newViewpoint, animationDuration));
+    requestGeoViewNavigationUpdate(newViewpoint);
   }
 
   void OverviewMapController::applyMapNavigationToInset(MapViewToolkit* view)
@@ -374,8 +606,7 @@ namespace Esri::ArcGISRuntime::Toolkit
     const Viewpoint viewpoint = view->currentViewpoint(ViewpointType::CenterAndScale);
     const Viewpoint newViewpoint{geometry_cast<Point>(viewpoint.targetGeometry()), viewpoint.targetScale() * scaleFactor(), viewpoint.rotation()};
 
-    constexpr float animationDuration{0};
-    startInsetNavigationUpdate(m_insetView->setViewpointAsync(newViewpoint, animationDuration));
+    requestInsetNavigationUpdate(newViewpoint);
   }
 
   void OverviewMapController::applySceneNavigationToInset(SceneViewToolkit* view)
@@ -384,8 +615,7 @@ namespace Esri::ArcGISRuntime::Toolkit
     const Viewpoint viewpoint = view->currentViewpoint(ViewpointType::CenterAndScale);
     const Viewpoint newViewpoint{geometry_cast<Point>(viewpoint.targetGeometry()), viewpoint.targetScale() * scaleFactor()};
 
-    constexpr float animationDuration{0};
-    startInsetNavigationUpdate(m_insetView->setViewpointAsync(newViewpoint, animationDuration));
+    requestInsetNavigationUpdate(newViewpoint);
   }
 
   void OverviewMapController::applyLocalSceneNavigationToInset(LocalSceneViewToolkit* view)
@@ -394,8 +624,7 @@ namespace Esri::ArcGISRuntime::Toolkit
     const Viewpoint viewpoint = view->currentViewpoint(ViewpointType::CenterAndScale);
     const Viewpoint newViewpoint{geometry_cast<Point>(viewpoint.targetGeometry()), viewpoint.targetScale() * scaleFactor()};
 
-    constexpr float animationDuration{0};
-    startInsetNavigationUpdate(m_insetView->setViewpointAsync(newViewpoint, animationDuration));
+    requestInsetNavigationUpdate(newViewpoint);
   }
 
   void OverviewMapController::disableInteractions()
@@ -442,9 +671,103 @@ namespace Esri::ArcGISRuntime::Toolkit
 #endif
   }
 
+  bool OverviewMapController::isStaticInsetReady() const
+  {
+    return m_isStaticInset && m_staticInset && m_staticInset->isReady();
+  }
+
+  // whether the inset needs a live map, in static mode only to export rasters not cached yet
+  bool OverviewMapController::needsLiveInset() const
+  {
+    return !isStaticInsetReady() || !m_staticInset->missingRasters().isEmpty();
+  }
+
+  double OverviewMapController::geoViewScale() const
+  {
+    if (auto* sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+    {
+      return sceneView->currentViewpoint(ViewpointType::CenterAndScale).targetScale();
+    }
+    else if (auto* localSceneView = qobject_cast<LocalSceneViewToolkit*>(m_geoView))
+    {
+      return localSceneView->currentViewpoint(ViewpointType::CenterAndScale).targetScale();
+    }
+    else if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    {
+      return mapView->currentViewpoint(ViewpointType::CenterAndScale).targetScale();
+    }
+    return 0.0;
+  }
+
+  void OverviewMapController::setupInsetMap()
+  {
+    if (auto* sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+    {
+      if (sceneView->arcGISScene() && sceneView->arcGISScene()->loadStatus() == LoadStatus::Loaded)
+      {
+        setupInsetMapForScene(sceneView);
+      }
+    }
+    else if (auto* localSceneView = qobject_cast<LocalSceneViewToolkit*>(m_geoView))
+    {
+      if (localSceneView->arcGISScene() && localSceneView->arcGISScene()->loadStatus() == LoadStatus::Loaded)
+      {
+        setupInsetMapForLocalScene(localSceneView);
+      }
+    }
+    else if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    {
+      if (mapView->map() && mapView->map()->loadStatus() == LoadStatus::Loaded)
+      {
+        setupInsetMapForMap(mapView);
+      }
+    }
+  }
+
+  // exports the rasters not cached yet from the live map, which is released once they are done
+  void OverviewMapController::generateStaticInset()
+  {
+    if (!m_isStaticInset || !m_staticInset || m_staticInset->isGenerating() || !m_insetView->map())
+    {
+      return;
+    }
+
+    const auto keys = m_staticInset->missingRasters();
+    if (keys.isEmpty())
+    {
+      if (m_staticInset->isReady())
+      {
+        releaseInsetMap();
+      }
+      return;
+    }
+
+    m_staticInset->generate(m_insetView, keys);
+  }
+
+  void OverviewMapController::releaseInsetMap()
+  {
+    auto* map = m_insetView->map();
+    if (!map)
+    {
+      return;
+    }
+
+    // drawn from the rasters from now on, so the inset map no longer needs to request tiles or render
+    m_insetView->setMap(nullptr);
+    map->deleteLater();
+    emit liveInsetChanged();
+  }
+
   // create a function to handle setting up the inset map and viewpoint
   void OverviewMapController::setupInsetMapForMap(MapViewToolkit* mapView)
   {
+    if (!needsLiveInset())
+    {
+      updateReticle();
+      return;
+    }
+
     // create the map
     auto* map = new Map(BasemapStyle::ArcGISTopographic, m_insetView);
 
@@ -456,11 +779,20 @@ namespace Esri::ArcGISRuntime::Toolkit
     // set the initial viewpoint before setting on the mapview
     map->setInitialViewpoint(newViewpoint);
     m_insetView->setMap(map);
+    emit liveInsetChanged();
+
+    generateStaticInset();
   }
 
   // create a function to handle setting up the inset map and viewpoint
   void OverviewMapController::setupInsetMapForScene(SceneViewToolkit* sceneView)
   {
+    if (!needsLiveInset())
+    {
+      updateReticle();
+      return;
+    }
+
     // create the map
     auto* map = new Map(BasemapStyle::ArcGISTopographic, m_insetView);
     // set the initial viewpoint (scale = main scene's scale * scaleFactor)
@@ -471,11 +803,20 @@ namespace Esri::ArcGISRuntime::Toolkit
     // set the initial viewpoint before setting on the inset view
     map->setInitialViewpoint(newViewpoint);
     m_insetView->setMap(map);
+    emit liveInsetChanged();
+
+    generateStaticInset();
   }
 
   // create a function to handle setting up the inset map and viewpoint
   void OverviewMapController::setupInsetMapForLocalScene(LocalSceneViewToolkit* localSceneView)
   {
+    if (!needsLiveInset())
+    {
+      updateReticle();
+      return;
+    }
+
     // create the map
     auto* map = new Map(BasemapStyle::ArcGISTopographic, m_insetView);
     // set the initial viewpoint (scale = main scene's scale * scaleFactor)
@@ -486,6 +827,9 @@ namespace Esri::ArcGISRuntime::Toolkit
     // set the initial viewpoint before setting on the inset view
     map->setInitialViewpoint(newViewpoint);
     m_insetView->setMap(map);
+    emit liveInsetChanged();
+
+    generateStaticInset();
   }
 
 } // namespace Esri::ArcGISRuntime::Toolkit
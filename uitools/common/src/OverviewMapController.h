@@ -20,6 +20,12 @@
 #include <QFuture>
 #include <QFutureWatcher>
 #include <QObject>
+#include <QTimer>
+#include <QUrl>
+#include <QVariantList>
+
+// ArcGISRuntime headers
+#include <Viewpoint.h>
 
 // Other headers
 #include "GeoViews.h"
@@ -33,12 +39,18 @@ namespace Esri::ArcGISRuntime
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
+  class OverviewMapStaticInset;
+
   class OverviewMapController : public QObject
   {
     Q_OBJECT
     Q_PROPERTY(QObject* geoView READ geoView WRITE setGeoView NOTIFY geoViewChanged)
     Q_PROPERTY(QObject* insetView READ insetView CONSTANT)
     Q_PROPERTY(double scaleFactor READ scaleFactor WRITE setScaleFactor NOTIFY scaleFactorChanged)
+    Q_PROPERTY(bool staticInset READ isStaticInset WRITE setStaticInset NOTIFY staticInsetChanged)
+    Q_PROPERTY(QUrl staticInsetImage READ staticInsetImage NOTIFY staticInsetReticleChanged)
+    Q_PROPERTY(QVariantList staticInsetReticle READ staticInsetReticle NOTIFY staticInsetReticleChanged)
+    Q_PROPERTY(bool liveInset READ isLiveInset NOTIFY liveInsetChanged)
   public:
     Q_INVOKABLE OverviewMapController(QObject* parent = nullptr);
 
@@ -55,15 +67,26 @@ namespace Esri::ArcGISRuntime::Toolkit
     double scaleFactor() const;
     void setScaleFactor(double scaleFactor);
 
+    bool isStaticInset() const;
+    void setStaticInset(bool staticInset);
+
+    QUrl staticInsetImage() const;
+    QVariantList staticInsetReticle() const;
+
+    bool isLiveInset() const;
+
   signals:
     void geoViewChanged();
     void scaleFactorChanged();
     void symbolChanged();
+    void staticInsetChanged();
+    void staticInsetReticleChanged();
+    void liveInsetChanged();
 
   private:
-    void applyInsetNavigationToMapView(MapViewToolkit* view);
-    void applyInsetNavigationToSceneView(SceneViewToolkit* view);
-    void applyInsetNavigationToLocalSceneView(LocalSceneViewToolkit* view);
+    void applyInsetNavigationToMapView();
+    void applyInsetNavigationToSceneView();
+    void applyInsetNavigationToLocalSceneView();
 
     void applyMapNavigationToInset(MapViewToolkit* view);
     void applySceneNavigationToInset(SceneViewToolkit* view);
@@ -72,8 +95,21 @@ namespace Esri::ArcGISRuntime::Toolkit
     void disableInteractions();
 
     void resetNavigationSynchronization();
-    void startGeoViewNavigationUpdate(const QFuture<bool>& future);
-    void startInsetNavigationUpdate(const QFuture<bool>& future);
+    void requestGeoViewNavigationUpdate(const Viewpoint& viewpoint);
+    void requestInsetNavigationUpdate(const Viewpoint& viewpoint);
+    void startGeoViewNavigationUpdate(const Viewpoint& viewpoint);
+    void startInsetNavigationUpdate(const Viewpoint& viewpoint);
+
+    void scheduleReticleUpdate();
+    void updateReticle();
+    void updateStaticInsetReticle();
+
+    bool isStaticInsetReady() const;
+    bool needsLiveInset() const;
+    double geoViewScale() const;
+    void setupInsetMap();
+    void generateStaticInset();
+    void releaseInsetMap();
 
     void setupInsetMapForMap(MapViewToolkit* mapView);
     void setupInsetMapForScene(SceneViewToolkit* sceneView);
@@ -82,12 +118,21 @@ namespace Esri::ArcGISRuntime::Toolkit
   private:
     QFutureWatcher<bool> m_setViewpointWatcher;
     QFutureWatcher<bool> m_setViewpointInsetWatcher;
+    // the latest viewpoint requested while an update in that direction was in flight, empty if none
+    Viewpoint m_pendingGeoViewViewpoint;
+    Viewpoint m_pendingInsetViewpoint;
+    QTimer m_reticleUpdateTimer;
     MapViewToolkit* m_insetView = nullptr;
     QObject* m_geoView = nullptr;
     Graphic* m_reticle = nullptr;
+    // created the first time the static inset is enabled
+    OverviewMapStaticInset* m_staticInset = nullptr;
+    QUrl m_staticInsetImage;
+    QVariantList m_staticInsetReticle;
     double m_scaleFactor = 25.0;
     bool m_isUpdatingGeoViewFromInset = false;
     bool m_isUpdatingInsetFromGeoView = false;
+    bool m_isStaticInset = false;
   };
 
 } // namespace Esri::ArcGISRuntime::Toolkit
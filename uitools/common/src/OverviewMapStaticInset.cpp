@@ -0,0 +1,497 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "OverviewMapStaticInset.h"
+
+// ArcGISRuntime headers
+#include <Geometry.h>
+#include <GeometryEngine.h>
+#include <ImmutablePart.h>
+#include <ImmutablePartCollection.h>
+#include <MapViewTypes.h>
+#include <Multipart.h>
+#include <Point.h>
+#include <Polygon.h>
+#include <SpatialReference.h>
+#include <Viewpoint.h>
+
+// Qt headers
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QFuture>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointF>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+// std headers
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    // bump when the layout of the index or the rasters changes, files of other versions are regenerated
+    constexpr int fileVersion = 3;
+
+    // A raster is exported for every Web Mercator tile of these levels, 21 in all, so the set is fixed
+    // and generated once. Level 0 is the world raster.
+    constexpr int levels[] = {0, 1, 2};
+
+    constexpr double webMercatorHalfWidth = 20037508.342789244;
+
+    constexpr int drawTimeoutMilliseconds = 30000;
+
+    QString indexFileName()
+    {
+      return QStringLiteral("index.json");
+    }
+
+    QString tileKey(int level, qint64 column, qint64 row)
+    {
+      return QStringLiteral("%1/%2/%3").arg(level).arg(column).arg(row);
+    }
+
+    QString worldKey()
+    {
+      return tileKey(0, 0, 0);
+    }
+
+    double tileWidth(int level)
+    {
+      return 2.0 * webMercatorHalfWidth / static_cast<double>(qint64{1} << level);
+    }
+
+    Envelope tileExtent(const QString& key)
+    {
+      const auto parts = key.split(QLatin1Char('/'));
+      if (parts.size() != 3)
+      {
+        return {};
+      }
+
+      const auto width = tileWidth(parts.at(0).toInt());
+      const auto xMin = -webMercatorHalfWidth + parts.at(1).toLongLong() * width;
+      const auto yMin = -webMercatorHalfWidth + parts.at(2).toLongLong() * width;
+      return Envelope(xMin, yMin, xMin + width, yMin + width, SpatialReference::webMercator());
+    }
+
+    // The key of the tile of \a level containing all of \a extent, or an empty string if it straddles tiles.
+    QString tileContaining(const Envelope& extent, int level)
+    {
+      const auto width = tileWidth(level);
+      const auto column = static_cast<qint64>(std::floor((extent.xMin() + webMercatorHalfWidth) / width));
+      const auto row = static_cast<qint64>(std::floor((extent.yMin() + webMercatorHalfWidth) / width));
+      const auto tileCount = qint64{1} << level;
+      if (column < 0 || row < 0 || column >= tileCount || row >= tileCount ||
+          extent.xMax() > -webMercatorHalfWidth + (column + 1) * width ||
+          extent.yMax() > -webMercatorHalfWidth + (row + 1) * width)
+      {
+        return {};
+      }
+
+      return tileKey(level, column, row);
+    }
+
+    QStringList allTileKeys()
+    {
+      QStringList keys;
+      for (const auto level : levels)
+      {
+        const auto tileCount = qint64{1} << level;
+        for (qint64 column = 0; column < tileCount; ++column)
+        {
+          for (qint64 row = 0; row < tileCount; ++row)
+          {
+            keys.append(tileKey(level, column, row));
+          }
+        }
+      }
+      return keys;
+    }
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::OverviewMapStaticInset
+    \brief Images of the inset basemap, exported from a live inset view and cached to disk.
+
+    A raster of the whole world and rasters of the Web Mercator tiles of a few finer levels are
+    exported once, then persisted alongside a JSON index of the extents they cover. From then on the
+    inset is drawn from them without a live map.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  OverviewMapStaticInset::OverviewMapStaticInset(const QString& directory, QObject* parent) :
+    QObject(parent),
+    m_directory(directory)
+  {
+    m_drawTimeoutTimer.setSingleShot(true);
+    m_drawTimeoutTimer.setInterval(drawTimeoutMilliseconds);
+    connect(&m_drawTimeoutTimer, &QTimer::timeout, this, [this]
+    {
+      qDebug() << "The overview map did not finish drawing, raster" << m_currentKey << "was not exported";
+      skipRaster();
+    });
+
+    load();
+  }
+
+  OverviewMapStaticInset::~OverviewMapStaticInset() = default;
+
+  /*!
+    \brief Returns the directory in the application's cache directory rasters are persisted to.
+   */
+  QString OverviewMapStaticInset::defaultDirectory()
+  {
+    return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).filePath(QStringLiteral("OverviewMap"));
+  }
+
+  /*!
+    \brief Returns \c true once the world raster is available.
+   */
+  bool OverviewMapStaticInset::isReady() const
+  {
+    return m_rasters.contains(worldKey());
+  }
+
+  bool OverviewMapStaticInset::isGenerating() const
+  {
+    return m_isGenerating;
+  }
+
+  /*!
+    \brief Returns the finest cached raster of a tile containing \a insetExtent, the Web Mercator extent
+    the inset should show.
+
+    The world raster is returned when no regional raster covers all of \a insetExtent.
+   */
+  OverviewMapStaticInset::Raster OverviewMapStaticInset::rasterFor(const Envelope& insetExtent) const
+  {
+    if (!insetExtent.isEmpty())
+    {
+      for (auto it = std::crbegin(levels); it != std::crend(levels); ++it)
+      {
+        if (*it == 0 || tileWidth(*it) < std::max(insetExtent.width(), insetExtent.height()))
+        {
+          continue;
+        }
+
+        const auto raster = m_rasters.constFind(tileContaining(insetExtent, *it));
+        if (raster != m_rasters.cend())
+        {
+          return raster.value();
+        }
+      }
+    }
+
+    return m_rasters.value(worldKey());
+  }
+
+  /*!
+    \brief Returns the keys of the rasters of the fixed set which are not cached, the world raster first.
+
+    Rasters which failed to export are only tried again in the next session.
+   */
+  QStringList OverviewMapStaticInset::missingRasters() const
+  {
+    auto keys = allTileKeys();
+    keys.erase(std::remove_if(keys.begin(), keys.end(), [this](const QString& key)
+    {
+      return m_rasters.contains(key) || m_failedKeys.contains(key);
+    }),
+               keys.end());
+    return keys;
+  }
+
+  /*!
+    \brief Exports the rasters of \a keys from \a view, which must display the inset basemap.
+
+    The view is navigated to each raster's tile in turn and exported once it has finished drawing.
+    A raster which cannot be exported is skipped. \c generatingChanged is emitted once all of \a keys
+    have been handled and the new rasters have been written to disk.
+   */
+  void OverviewMapStaticInset::generate(MapViewToolkit* view, const QStringList& keys)
+  {
+    if (!view || m_isGenerating || keys.isEmpty())
+    {
+      return;
+    }
+
+    m_view = view;
+    m_isGenerating = true;
+    m_hasNewRasters = false;
+    m_pendingKeys = keys;
+    emit generatingChanged();
+
+    generateNext();
+  }
+
+  /*!
+    \brief Returns the rings of \a geometry as lists of points normalized to \a extent, with y down.
+
+    A point geometry is returned as a single ring of one point.
+   */
+  QVariantList OverviewMapStaticInset::reticle(const Geometry& geometry, const Envelope& extent)
+  {
+    QVariantList rings;
+    const auto width = extent.width();
+    const auto height = extent.height();
+    if (geometry.isEmpty() || width <= 0.0 || height <= 0.0)
+    {
+      return rings;
+    }
+
+    const auto normalized = [&extent, width, height](const Point& point)
+    {
+      return QPointF((point.x() - extent.xMin()) / width, (extent.yMax() - point.y()) / height);
+    };
+
+    switch (geometry.geometryType())
+    {
+      case GeometryType::Point:
+        rings.append(QVariant(QVariantList{normalized(geometry_cast<Point>(geometry))}));
+        break;
+      case GeometryType::Polyline:
+      case GeometryType::Polygon:
+      {
+        const auto parts = geometry_cast<Multipart>(geometry).parts();
+        for (qsizetype i = 0; i < parts.size(); ++i)
+        {
+          const auto part = parts.part(i);
+          QVariantList ring;
+          ring.reserve(part.pointCount());
+          for (qsizetype j = 0; j < part.pointCount(); ++j)
+          {
+            ring.append(normalized(part.point(j)));
+          }
+          rings.append(QVariant(ring));
+        }
+        break;
+      }
+      default:
+        break;
+    }
+
+    return rings;
+  }
+
+  void OverviewMapStaticInset::generateNext()
+  {
+    if (!m_view || m_pendingKeys.isEmpty())
+    {
+      finishGeneration();
+      return;
+    }
+
+    m_currentKey = m_pendingKeys.takeFirst();
+
+    constexpr float animationDuration{0};
+    m_drawTimeoutTimer.start();
+    const auto key = m_currentKey;
+    m_view->setViewpointAsync(Viewpoint(tileExtent(key)), animationDuration).then(this, [this, key](bool)
+    {
+      // the raster may have timed out meanwhile
+      if (key == m_currentKey)
+      {
+        waitForDrawing();
+      }
+    })
+      .onFailed(this, [this, key]()
+    {
+      if (key == m_currentKey)
+      {
+        skipRaster();
+      }
+    });
+  }
+
+  void OverviewMapStaticInset::waitForDrawing()
+  {
+    if (!m_view)
+    {
+      finishGeneration();
+      return;
+    }
+
+    // cached tiles may have been drawn before the viewpoint was reported as set
+    if (m_view->drawStatus() == DrawStatus::Completed)
+    {
+      exportRaster();
+      return;
+    }
+
+    // exported once the tiles of the new extent have been drawn
+    m_drawStatusConnection = connect(m_view, &MapViewToolkit::drawStatusChanged, this, [this](DrawStatus status)
+    {
+      if (status == DrawStatus::Completed)
+      {
+        disconnect(m_drawStatusConnection);
+        exportRaster();
+      }
+    });
+  }
+
+  void OverviewMapStaticInset::exportRaster()
+  {
+    if (!m_view)
+    {
+      finishGeneration();
+      return;
+    }
+
+    const auto visibleExtent = m_view->visibleArea().extent();
+    const auto extent = visibleExtent.spatialReference() == SpatialReference::webMercator()
+                          ? visibleExtent
+                          : geometry_cast<Envelope>(GeometryEngine::project(visibleExtent, SpatialReference::webMercator()));
+    const auto filePath = QDir(m_directory).filePath(QString(m_currentKey).replace(QLatin1Char('/'), QLatin1Char('_')) + QStringLiteral(".png"));
+
+    const auto key = m_currentKey;
+    m_view->exportImageAsync().then(this, [this, key, extent, filePath](const QImage& image)
+    {
+      if (key != m_currentKey)
+      {
+        return;
+      }
+
+      QDir().mkpath(m_directory);
+
+      // written to a temporary file first, so a crash never leaves a truncated raster behind
+      QSaveFile file(filePath);
+      if (image.isNull() || !file.open(QIODevice::WriteOnly) || !image.save(&file, "PNG") || !file.commit())
+      {
+        qDebug() << "Could not save the overview map raster to" << filePath << file.errorString();
+        skipRaster();
+        return;
+      }
+
+      m_drawTimeoutTimer.stop();
+      m_rasters.insert(m_currentKey, {filePath, extent});
+      m_hasNewRasters = true;
+      generateNext();
+    })
+      .onFailed(this, [this, key]()
+    {
+      if (key == m_currentKey)
+      {
+        skipRaster();
+      }
+    });
+  }
+
+  void OverviewMapStaticInset::skipRaster()
+  {
+    disconnect(m_drawStatusConnection);
+    m_drawTimeoutTimer.stop();
+    m_failedKeys.insert(m_currentKey);
+    m_currentKey.clear();
+    generateNext();
+  }
+
+  void OverviewMapStaticInset::finishGeneration()
+  {
+    disconnect(m_drawStatusConnection);
+    m_drawTimeoutTimer.stop();
+    if (!m_isGenerating)
+    {
+      return;
+    }
+
+    m_isGenerating = false;
+    m_view.clear();
+    m_pendingKeys.clear();
+    m_currentKey.clear();
+
+    if (m_hasNewRasters)
+    {
+      save();
+    }
+    emit generatingChanged();
+  }
+
+  void OverviewMapStaticInset::load()
+  {
+    QFile file(QDir(m_directory).filePath(indexFileName()));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+      return;
+    }
+
+    const auto root = QJsonDocument::fromJson(file.readAll()).object();
+    if (root.value(QStringLiteral("version")).toInt() != fileVersion)
+    {
+      return;
+    }
+
+    const auto rasters = root.value(QStringLiteral("rasters")).toArray();
+    for (const auto& value : rasters)
+    {
+      const auto object = value.toObject();
+      const auto key = object.value(QStringLiteral("key")).toString();
+      const auto filePath = QDir(m_directory).filePath(object.value(QStringLiteral("file")).toString());
+      if (key.isEmpty() || !QFileInfo::exists(filePath))
+      {
+        continue;
+      }
+
+      m_rasters.insert(key, {filePath,
+                         Envelope(object.value(QStringLiteral("xMin")).toDouble(),
+                                  object.value(QStringLiteral("yMin")).toDouble(),
+                                  object.value(QStringLiteral("xMax")).toDouble(),
+                                  object.value(QStringLiteral("yMax")).toDouble(),
+                                  SpatialReference::webMercator())});
+    }
+  }
+
+  void OverviewMapStaticInset::save() const
+  {
+    auto keys = m_rasters.keys();
+    std::sort(keys.begin(), keys.end());
+
+    QJsonArray rasters;
+    for (const auto& key : std::as_const(keys))
+    {
+      const auto raster = m_rasters.value(key);
+      rasters.append(QJsonObject{{QStringLiteral("key"), key},
+                                 {QStringLiteral("file"), QFileInfo(raster.filePath).fileName()},
+                                 {QStringLiteral("xMin"), raster.extent.xMin()},
+                                 {QStringLiteral("yMin"), raster.extent.yMin()},
+                                 {QStringLiteral("xMax"), raster.extent.xMax()},
+                                 {QStringLiteral("yMax"), raster.extent.yMax()}});
+    }
+
+    const QJsonObject root{{QStringLiteral("version"), fileVersion},
+                           {QStringLiteral("rasters"), rasters}};
+
+    QDir().mkpath(m_directory);
+
+    const auto filePath = QDir(m_directory).filePath(indexFileName());
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) < 0 || !file.commit())
+    {
+      qDebug() << "Could not save the overview map raster index to" << filePath << file.errorString();
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
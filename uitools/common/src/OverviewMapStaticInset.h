@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_OVERVIEWMAPSTATICINSET_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_OVERVIEWMAPSTATICINSET_H
+
+// Qt headers
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <QVariantList>
+
+// ArcGISRuntime headers
+#include <Envelope.h>
+
+// Other headers
+#include "GeoViews.h"
+
+namespace Esri::ArcGISRuntime
+{
+  class Geometry;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class OverviewMapStaticInset : public QObject
+  {
+    Q_OBJECT
+
+  public:
+    // An image of the inset basemap and the Web Mercator extent it covers.
+    struct Raster
+    {
+      QString filePath;
+      Envelope extent;
+    };
+
+    explicit OverviewMapStaticInset(const QString& directory = defaultDirectory(), QObject* parent = nullptr);
+    ~OverviewMapStaticInset() override;
+
+    static QString defaultDirectory();
+
+    bool isReady() const;
+
+    bool isGenerating() const;
+
+    Raster rasterFor(const Envelope& insetExtent) const;
+
+    QStringList missingRasters() const;
+
+    void generate(MapViewToolkit* view, const QStringList& keys);
+
+    static QVariantList reticle(const Geometry& geometry, const Envelope& extent);
+
+  signals:
+    void generatingChanged();
+
+  private:
+    void load();
+    void save() const;
+    void generateNext();
+    void waitForDrawing();
+    void exportRaster();
+    void skipRaster();
+    void finishGeneration();
+
+    QString m_directory;
+    // keyed by tile, see tileKey
+    QHash<QString, Raster> m_rasters;
+    // rasters which could not be exported, not tried again this session
+    QSet<QString> m_failedKeys;
+    QStringList m_pendingKeys;
+    QString m_currentKey;
+    QPointer<MapViewToolkit> m_view;
+    QMetaObject::Connection m_drawStatusConnection;
+    // gives up on a raster whose drawing never completes, for example while the view is not on screen
+    QTimer m_drawTimeoutTimer;
+    bool m_isGenerating = false;
+    bool m_hasNewRasters = false;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_OVERVIEWMAPSTATICINSET_H
@@ -52,27 +52,74 @@ namespace Esri::ArcGISRuntime::Toolkit
   PieChartPopupMediaItem::PieChartPopupMediaItem(PopupMedia* popupMedia, QObject* parent) :
     PopupMediaItem{popupMedia, parent}
   {
+    updateValues();
   }
 
   PieChartPopupMediaItem::~PieChartPopupMediaItem() = default;
 
-  QVariantList PieChartPopupMediaItem::pieSlices()
+  void PieChartPopupMediaItem::setPopupMedia(PopupMedia* popupMedia)
   {
-    QVariantList pieSlices;
+    if (popupMedia == popupMediaItem())
+    {
+      return;
+    }
+
+    PopupMediaItem::setPopupMedia(popupMedia);
+    updateValues();
+    emit pieChartPopupMediaItemChanged();
+  }
+
+  void PieChartPopupMediaItem::updateValues()
+  {
+    m_values.clear();
+    m_colors.clear();
+
+    if (!popupMediaItem())
+    {
+      // unbound while pooled
+      m_labels.clear();
+      return;
+    }
+
+    // the media value is read once, the lists it returns are copies
     auto mediaValue = popupMediaItem()->value();
-    const auto popupMediaValueDataLength = mediaValue->data().length();
+    const auto data = mediaValue->data();
     const auto chartColors = mediaValue->chartColors();
+    const auto popupMediaValueDataLength = data.length();
     const auto colorsHasLessThanLabels = chartColors.size() < popupMediaValueDataLength;
 
+    m_labels = mediaValue->labels().mid(0, popupMediaValueDataLength);
+    m_values.reserve(popupMediaValueDataLength);
     for (int i = 0; i < popupMediaValueDataLength; i++)
     {
-      const auto label = mediaValue->labels().at(i);
-      const auto value = mediaValue->data().at(i).toReal();
-      auto* pieSlice = new QPieSlice(label, value);
+      m_values.append(data.at(i).toReal());
+    }
 
-      if (!chartColors.isEmpty() && !colorsHasLessThanLabels)
+    if (!chartColors.isEmpty() && !colorsHasLessThanLabels)
+    {
+      m_colors = chartColors.mid(0, popupMediaValueDataLength);
+    }
+  }
+
+  /*!
+    \internal
+    Returns a new QPieSlice for each value, built from the values computed when this item was bound to its media.
+
+    The slices are unparented because the PieSeries they are appended to takes ownership of them, and a slice
+    can only belong to one series, so every chart showing this item needs its own.
+   */
+  QVariantList PieChartPopupMediaItem::pieSlices() const
+  {
+    QVariantList pieSlices;
+    pieSlices.reserve(m_values.size());
+
+    for (int i = 0; i < m_values.size(); i++)
+    {
+      auto* pieSlice = new QPieSlice(m_labels.at(i), m_values.at(i));
+
+      if (!m_colors.isEmpty())
       {
-        const auto color = chartColors.at(i);
+        const auto color = m_colors.at(i);
         const auto labelColor = determineLabelColor(color);
         pieSlice->setColor(color);
         pieSlice->setBorderColor(color);
@@ -80,7 +127,6 @@ namespace Esri::ArcGISRuntime::Toolkit
       }
       pieSlices.append(QVariant::fromValue(pieSlice));
     }
-    emit pieChartPopupMediaItemChanged();
     return pieSlices;
   }
 
@@ -17,8 +17,11 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_PIECHARTPOPUPMEDIAITEM_H
 
 // Qt headers
+#include <QColor>
 #include <QJsonArray>
+#include <QList>
 #include <QObject>
+#include <QStringList>
 #include <QVariant>
 
 // Other headers
@@ -38,11 +41,20 @@ namespace Esri::ArcGISRuntime::Toolkit
     explicit PieChartPopupMediaItem(PopupMedia* popupMedia, QObject* parent = nullptr);
     ~PieChartPopupMediaItem() override;
 
+    void setPopupMedia(PopupMedia* popupMedia) override;
+
   private:
-    QVariantList pieSlices();
+    QVariantList pieSlices() const;
+    void updateValues();
 
   signals:
     void pieChartPopupMediaItemChanged();
+
+  private:
+    QStringList m_labels;
+    QList<qreal> m_values;
+    // empty unless there is a color for every value
+    QList<QColor> m_colors;
   };
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,215 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "PopupAttachmentDownloadScheduler.h"
+
+// Maps SDK headers
+#include <Attachment.h>
+#include <PopupAttachment.h>
+
+// Toolkit headers
+#include "PopupAttachmentItem.h"
+
+// Qt headers
+#include <QCoreApplication>
+
+// std headers
+#include <algorithm>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::PopupAttachmentDownloadScheduler
+    \brief Downloads popup attachments a few at a time, in the order they were asked for.
+
+    Requests are grouped by the PopupViewController showing them, so every download of a popup
+    can be cancelled at once when the popup is replaced.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  PopupAttachmentDownloadScheduler* PopupAttachmentDownloadScheduler::instance()
+  {
+    static QPointer<PopupAttachmentDownloadScheduler> self;
+    if (!self)
+    {
+      self = new PopupAttachmentDownloadScheduler(QCoreApplication::instance());
+    }
+    return self;
+  }
+
+  PopupAttachmentDownloadScheduler::PopupAttachmentDownloadScheduler(QObject* parent) :
+    QObject(parent)
+  {
+  }
+
+  PopupAttachmentDownloadScheduler::~PopupAttachmentDownloadScheduler() = default;
+
+  /*!
+    \brief Queues the download of the data of \a item on behalf of \a group.
+
+    A request for an item which is already queued or downloading is ignored. The item is handed
+    the data, or an empty array if the download failed or was cancelled.
+   */
+  void PopupAttachmentDownloadScheduler::request(PopupAttachmentItem* item, QObject* group)
+  {
+    if (!item)
+    {
+      return;
+    }
+
+    if (std::any_of(m_downloads.cbegin(), m_downloads.cend(), [item](const Download& download)
+    {
+      return download.item == item;
+    }) ||
+        std::any_of(m_queue.cbegin(), m_queue.cend(), [item](const Request& request)
+    {
+      return request.item == item;
+    }))
+    {
+      return;
+    }
+
+    m_queue.append(Request{item, group});
+
+    startNext();
+  }
+
+  /*!
+    \brief Drops the queued requests of \a group and cancels its downloads.
+   */
+  void PopupAttachmentDownloadScheduler::cancel(QObject* group)
+  {
+    cancelIf([group](QObject* requestGroup, PopupAttachmentItem*)
+    {
+      return requestGroup == group;
+    });
+  }
+
+  /*!
+    \brief Drops the queued request of \a item, or cancels its download.
+   */
+  void PopupAttachmentDownloadScheduler::cancelRequest(PopupAttachmentItem* item)
+  {
+    cancelIf([item](QObject*, PopupAttachmentItem* requestItem)
+    {
+      return requestItem == item;
+    });
+  }
+
+  void PopupAttachmentDownloadScheduler::cancelIf(const std::function<bool(QObject*, PopupAttachmentItem*)>& predicate)
+  {
+    QList<QPointer<PopupAttachmentItem>> cancelledItems;
+
+    m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(), [&predicate, &cancelledItems](const Request& request)
+    {
+      if (!predicate(request.group, request.item.data()))
+      {
+        return false;
+      }
+
+      cancelledItems.append(request.item);
+      return true;
+    }), m_queue.end());
+
+    for (auto it = m_downloads.begin(); it != m_downloads.end();)
+    {
+      if (!predicate(it->group, it->item.data()))
+      {
+        ++it;
+        continue;
+      }
+
+      it->future.cancel();
+      cancelledItems.append(it->item);
+      it = m_downloads.erase(it);
+    }
+
+    for (const auto& item : std::as_const(cancelledItems))
+    {
+      if (item)
+      {
+        item->onAttachmentDataFetched({});
+      }
+    }
+
+    startNext();
+  }
+
+  /*!
+    \brief Returns the maximum number of attachments downloaded at the same time. Defaults to 3.
+   */
+  int PopupAttachmentDownloadScheduler::maximumConcurrentDownloads() const
+  {
+    return m_maximumConcurrentDownloads;
+  }
+
+  void PopupAttachmentDownloadScheduler::setMaximumConcurrentDownloads(int maximumConcurrentDownloads)
+  {
+    m_maximumConcurrentDownloads = std::max(1, maximumConcurrentDownloads);
+    startNext();
+  }
+
+  void PopupAttachmentDownloadScheduler::startNext()
+  {
+    while (m_downloads.size() < m_maximumConcurrentDownloads && !m_queue.isEmpty())
+    {
+      const auto request = m_queue.takeFirst();
+      if (!request.item)
+      {
+        continue;
+      }
+
+      if (!request.item->popupAttachment())
+      {
+        // deleted with its popup while queued
+        request.item->onAttachmentDataFetched({});
+        continue;
+      }
+
+      const auto id = m_nextDownloadId++;
+      auto future = request.item->popupAttachment()->attachment()->fetchDataAsync();
+      m_downloads.insert(id, Download{request.item, request.group, future});
+
+      // a cancelled download's continuations are dropped by finish, even if the service still answers
+      future.then(this, [this, id](const QByteArray& attachmentData)
+      {
+        finish(id, attachmentData);
+      })
+        .onCanceled(this, [this, id]()
+      {
+        finish(id, {});
+      })
+        .onFailed(this, [this, id]()
+      {
+        finish(id, {});
+      });
+    }
+  }
+
+  void PopupAttachmentDownloadScheduler::finish(quint64 id, const QByteArray& attachmentData)
+  {
+    const auto download = m_downloads.take(id);
+    if (download.item)
+    {
+      download.item->onAttachmentDataFetched(attachmentData);
+    }
+
+    startNext();
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
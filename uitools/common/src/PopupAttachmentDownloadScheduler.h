@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPATTACHMENTDOWNLOADSCHEDULER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPATTACHMENTDOWNLOADSCHEDULER_H
+
+// Qt headers
+#include <QByteArray>
+#include <QFuture>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+
+// std headers
+#include <functional>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class PopupAttachmentItem;
+
+  class PopupAttachmentDownloadScheduler : public QObject
+  {
+    Q_OBJECT
+
+  public:
+    static PopupAttachmentDownloadScheduler* instance();
+
+    ~PopupAttachmentDownloadScheduler() override;
+
+    void request(PopupAttachmentItem* item, QObject* group);
+
+    void cancel(QObject* group);
+
+    void cancelRequest(PopupAttachmentItem* item);
+
+    int maximumConcurrentDownloads() const;
+    void setMaximumConcurrentDownloads(int maximumConcurrentDownloads);
+
+  private:
+    explicit PopupAttachmentDownloadScheduler(QObject* parent = nullptr);
+
+    void startNext();
+    void cancelIf(const std::function<bool(QObject*, PopupAttachmentItem*)>& predicate);
+    void finish(quint64 id, const QByteArray& attachmentData);
+
+    struct Request
+    {
+      QPointer<PopupAttachmentItem> item;
+      // compared only, never dereferenced
+      QObject* group = nullptr;
+    };
+
+    struct Download
+    {
+      QPointer<PopupAttachmentItem> item;
+      QObject* group = nullptr;
+      QFuture<QByteArray> future;
+    };
+
+    // in the order the requests were made
+    QList<Request> m_queue;
+    QHash<quint64, Download> m_downloads;
+    quint64 m_nextDownloadId = 0;
+    int m_maximumConcurrentDownloads = 3;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPATTACHMENTDOWNLOADSCHEDULER_H
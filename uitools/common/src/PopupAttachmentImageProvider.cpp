@@ -20,10 +20,7 @@
 #include "PopupAttachmentImageProvider.h"
 
 // Qt headers
-#include <QFileSystemModel>
 #include <QFuture>
-#include <QIcon>
-#include <QMimeDatabase>
 #include <QPointer>
 #include <QtGlobal>
 
@@ -33,6 +30,7 @@
 
 // Toolkit headers
 #include "PopupAttachmentItem.h"
+#include "PopupAttachmentThumbnailCache.h"
 
 namespace Esri::ArcGISRuntime::Toolkit
 {
@@ -52,8 +50,11 @@ namespace Esri::ArcGISRuntime::Toolkit
       QQuickTextureFactory* textureFactory() const override;
 
     private:
+      QImage icon() const;
+
       QPointer<PopupAttachmentItem> m_popupAttachmentItem;
       QSize m_requestedSize;
+      QImage m_image;
     };
 
     PopupAttachmentImageResponse::PopupAttachmentImageResponse(PopupAttachmentItem* popupAttachmentItem, QSize requestedSize) :
@@ -70,84 +71,44 @@ namespace Esri::ArcGISRuntime::Toolkit
       if (!thumbnail.isNull())
       {
         // We have a thumbnail to display so just go ahead and display this.
+        m_image = thumbnail;
         emit finished();
         return;
       }
 
-      auto item = m_popupAttachmentItem;
-      if (!item)
-      {
-        emit finished();
-        return;
-      }
-
-      auto itemThumbnail = item->thumbnail();
-      if (!itemThumbnail.isNull())
+      const auto localFile = m_popupAttachmentItem->localData().toLocalFile();
+      if (m_popupAttachmentItem->popupAttachmentType() != PopupAttachmentType::Image || localFile.isEmpty())
       {
-        // We have a good thumbnail.
+        m_image = icon();
         emit finished();
         return;
       }
 
-      auto popupAttachment = item->popupAttachment();
-      if (popupAttachment->popupAttachmentType() != PopupAttachmentType::Image)
+      // shares the decode the item started when its data was fetched
+      PopupAttachmentThumbnailCache::instance()->thumbnail(localFile).then(this, [this](const QImage& image)
       {
+        m_image = image.isNull() ? icon() : image;
         emit finished();
-        return;
-      }
+      });
     }
 
     PopupAttachmentImageResponse::~PopupAttachmentImageResponse() = default;
 
-    QQuickTextureFactory* PopupAttachmentImageResponse::textureFactory() const
+    QImage PopupAttachmentImageResponse::icon() const
     {
-      QImage thumbnail;
-      QIcon icon;
-
-      if (m_popupAttachmentItem)
+      if (!m_popupAttachmentItem || !m_popupAttachmentItem->dataFetched())
       {
-        thumbnail = m_popupAttachmentItem->thumbnail();
+        return {};
       }
 
-      // Handles edge case for Mobile since QAbstractFileIconProvider returns a Null QIcon.
-#if defined(Q_OS_IOS) || defined(Q_OS_ANDROID)
-      if (thumbnail.isNull() || m_popupAttachmentItem->popupAttachmentType() != PopupAttachmentType::Image)
-      {
-        switch (m_popupAttachmentItem->popupAttachmentType())
-        {
-          case PopupAttachmentType::Image:
-            icon = QIcon(QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/image.svg"));
-            break;
-          case PopupAttachmentType::Video:
-            icon = QIcon(QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/video.svg"));
-            break;
-          case PopupAttachmentType::Document:
-            icon = QIcon(QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/file.svg"));
-            break;
-          case PopupAttachmentType::Other:
-            [[fallthrough]];
-          default:
-            icon = QIcon(QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/other.svg"));
-            break;
-        }
-
-        auto pixmap = icon.pixmap(32, 32);
-        thumbnail = pixmap.toImage();
-        return QQuickTextureFactory::textureFactoryForImage(thumbnail);
-      }
-#endif
-
-      if (thumbnail.isNull() && m_popupAttachmentItem->dataFetched())
-      {
-        QFileSystemModel fileSystemModel;
-        auto index = fileSystemModel.index(m_popupAttachmentItem->localData().toLocalFile());
-        icon = fileSystemModel.fileIcon(index);
-
-        auto pixmap = icon.pixmap(32, 32);
-        thumbnail = pixmap.toImage();
-      }
+      return PopupAttachmentThumbnailCache::instance()->icon(m_popupAttachmentItem->localData().toLocalFile(),
+                                                             m_popupAttachmentItem->popupAttachment()->contentType(),
+                                                             m_popupAttachmentItem->popupAttachmentType());
+    }
 
-      return QQuickTextureFactory::textureFactoryForImage(m_requestedSize.isValid() ? thumbnail.scaled(m_requestedSize) : thumbnail);
+    QQuickTextureFactory* PopupAttachmentImageResponse::textureFactory() const
+    {
+      return QQuickTextureFactory::textureFactoryForImage(m_requestedSize.isValid() ? m_image.scaled(m_requestedSize) : m_image);
     }
   } // namespace
 
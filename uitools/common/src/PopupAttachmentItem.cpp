@@ -20,7 +20,6 @@
 #include "PopupAttachmentItem.h"
 
 // Qt headers
-#include <QAbstractFileIconProvider>
 #include <QFuture>
 #include <QtGlobal>
 
@@ -29,7 +28,9 @@
 #include <PopupAttachment.h>
 
 // Toolkit headers
+#include "PopupAttachmentDownloadScheduler.h"
 #include "PopupAttachmentImageProvider.h"
+#include "PopupAttachmentThumbnailCache.h"
 
 #include <PopupViewController.h>
 
@@ -71,10 +72,12 @@ namespace Esri::ArcGISRuntime::Toolkit
     QObject{parent},
     m_fetchingAttachment{false},
     m_popupAttachment{popupAttachment},
+    m_popupViewController{popupViewController},
     m_id{QUuid::createUuid()}
   {
     // connect signal to bubble up attachment data and name to PopupViewController
     connect(this, &PopupAttachmentItem::attachmentDataFetched, popupViewController, &PopupViewController::attachmentDataFetched);
+    connect(this, &PopupAttachmentItem::attachmentFileFetched, popupViewController, &PopupViewController::attachmentFileFetched);
 
     PopupAttachmentImageProvider::instance()->registerItem(this);
   }
@@ -86,22 +89,22 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   QString PopupAttachmentItem::name() const
   {
-    return m_popupAttachment->name();
+    return m_popupAttachment ? m_popupAttachment->name() : QString{};
   }
 
   QString PopupAttachmentItem::contentType() const
   {
-    return m_popupAttachment->contentType();
+    return m_popupAttachment ? m_popupAttachment->contentType() : QString{};
   }
 
   QString PopupAttachmentItem::size() const
   {
-    return formatFileSize(m_popupAttachment->size());
+    return m_popupAttachment ? formatFileSize(m_popupAttachment->size()) : QString{};
   }
 
   bool PopupAttachmentItem::dataFetched() const
   {
-    return m_popupAttachment->attachment()->isDataFetched() && m_popupAttachment->attachment()->attachmentUrl().isValid();
+    return m_popupAttachment && m_popupAttachment->attachment()->isDataFetched() && m_popupAttachment->attachment()->attachmentUrl().isValid();
   }
 
   bool PopupAttachmentItem::fetchingAttachment() const
@@ -111,7 +114,7 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   PopupAttachmentType PopupAttachmentItem::popupAttachmentType() const
   {
-    return m_popupAttachment->popupAttachmentType();
+    return m_popupAttachment ? m_popupAttachment->popupAttachmentType() : PopupAttachmentType::Other;
   }
 
   QUrl PopupAttachmentItem::localData() const
@@ -148,33 +151,62 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   void PopupAttachmentItem::downloadAttachment()
   {
+    if (m_fetchingAttachment || !m_popupAttachment)
+    {
+      return;
+    }
+
     m_fetchingAttachment = true;
     emit popupAttachmentItemChanged();
-    m_popupAttachment->attachment()->fetchDataAsync().then(this, [this](const QByteArray& attachmentData)
+    // the download is cancelled if the popup is replaced before it starts or completes
+    PopupAttachmentDownloadScheduler::instance()->request(this, m_popupViewController.data());
+  }
+
+  /*!
+    \internal
+    Called by the download scheduler with the data of the attachment, which is empty if the download failed or was cancelled.
+   */
+  void PopupAttachmentItem::onAttachmentDataFetched(const QByteArray& attachmentData)
+  {
+    if (attachmentData.isEmpty() || !m_popupAttachment)
     {
-      if (attachmentData.isEmpty())
-      {
-        m_fetchingAttachment = false;
-        emit popupAttachmentItemChanged();
-        return;
-      }
+      m_fetchingAttachment = false;
+      emit popupAttachmentItemChanged();
+      return;
+    }
 
+    m_localData = m_popupAttachment->attachment()->attachmentUrl();
+    const auto limit = m_popupViewController ? m_popupViewController->attachmentDataSizeLimit() : -1;
+    if (limit >= 0 && attachmentData.size() > limit)
+    {
+      // large attachments are only handed on as the file the data was saved to, the data itself is not forwarded
+      emit attachmentFileFetched(m_localData, name());
+    }
+    else
+    {
       // emit signal to bubble up attachment data and name to PopupViewController
       emit attachmentDataFetched(attachmentData, name());
-      m_localData = m_popupAttachment->attachment()->attachmentUrl();
-      m_fetchingAttachment = false;
-      // we delay the registration of this until the data has been fetched.
-      // Otherwise the creating of the thumbnail/image will do this for us.
-      if (m_popupAttachment->popupAttachmentType() == PopupAttachmentType::Image)
-      {
-        setThumbnail(QImage(m_localData.toLocalFile()));
-      }
-      else
+    }
+    m_fetchingAttachment = false;
+    // we delay the registration of this until the data has been fetched.
+    // Otherwise the creating of the thumbnail/image will do this for us.
+    if (m_popupAttachment->popupAttachmentType() == PopupAttachmentType::Image)
+    {
+      // decoded at thumbnail size off the GUI thread, the image provider waits for the same result
+      PopupAttachmentThumbnailCache::instance()->thumbnail(m_localData.toLocalFile()).then(this, [this, id = m_id](const QImage& thumbnail)
       {
-        setThumbnail(QImage());
-      }
-      emit popupAttachmentItemChanged();
-    });
+        // the item may have been recycled for another attachment in the meantime
+        if (id == m_id)
+        {
+          setThumbnail(thumbnail);
+        }
+      });
+    }
+    else
+    {
+      setThumbnail(QImage());
+    }
+    emit popupAttachmentItemChanged();
   }
 
   QUuid PopupAttachmentItem::id() const
@@ -193,6 +225,35 @@ namespace Esri::ArcGISRuntime::Toolkit
     return m_popupAttachment;
   }
 
+  /*!
+    \internal
+    Rebinds this item to \a popupAttachment, so the item can be recycled when the popup changes.
+
+    A download in progress for the previous attachment is cancelled, and the item is given a new id
+    so thumbnails of the previous attachment are not served from the image cache.
+   */
+  void PopupAttachmentItem::setPopupAttachment(PopupAttachment* popupAttachment)
+  {
+    if (m_popupAttachment == popupAttachment)
+    {
+      return;
+    }
+
+    if (m_fetchingAttachment)
+    {
+      PopupAttachmentDownloadScheduler::instance()->cancelRequest(this);
+    }
+
+    PopupAttachmentImageProvider::instance()->deregisterItem(this);
+    m_popupAttachment = popupAttachment;
+    m_id = QUuid::createUuid();
+    m_localData.clear();
+    m_thumbnail = QImage();
+    PopupAttachmentImageProvider::instance()->registerItem(this);
+
+    emit popupAttachmentItemChanged();
+  }
+
   QImage PopupAttachmentItem::thumbnail() const
   {
     return m_thumbnail;
@@ -19,6 +19,7 @@
 // Qt headers
 #include <QImage>
 #include <QObject>
+#include <QPointer>
 #include <QTemporaryDir>
 #include <QUrl>
 #include <QtCore/quuid.h>
@@ -64,22 +65,27 @@ namespace Esri::ArcGISRuntime
     public:
       bool dataFetched() const;
       PopupAttachment* popupAttachment() const;
+      void setPopupAttachment(PopupAttachment* popupAttachment);
       PopupAttachmentType popupAttachmentType() const;
       QImage thumbnail() const;
       QUrl localData() const;
       QUuid id() const;
       void setThumbnail(const QImage& thumbnail);
+      void onAttachmentDataFetched(const QByteArray& attachmentData);
 
     signals:
       void popupAttachmentItemChanged();
       void attachmentDataFetched(const QByteArray& attachmentData, const QString& name);
+      void attachmentFileFetched(const QUrl& localData, const QString& name);
 
     private:
       bool m_fetchingAttachment{false};
-      PopupAttachment* m_popupAttachment = nullptr;
+      // null while the item is pooled, and once the popup owning the attachment is deleted
+      QPointer<PopupAttachment> m_popupAttachment;
+      QPointer<PopupViewController> m_popupViewController;
       QImage m_thumbnail;
       QUrl m_localData;
-      const QUuid m_id;
+      QUuid m_id;
     };
 
   } // namespace Toolkit
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "PopupAttachmentThumbnailCache.h"
+
+// Qt headers
+#include <QAbstractFileIconProvider>
+#include <QFileInfo>
+#include <QIcon>
+#include <QImageReader>
+#include <QMimeDatabase>
+#include <QMutexLocker>
+#include <QPainter>
+#include <QPromise>
+#include <QSvgRenderer>
+#include <QThreadPool>
+#include <QtGlobal>
+
+// std headers
+#include <memory>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    QString iconPath(PopupAttachmentType popupAttachmentType)
+    {
+      switch (popupAttachmentType)
+      {
+        case PopupAttachmentType::Image:
+          return QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/image.svg");
+        case PopupAttachmentType::Video:
+          return QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/video.svg");
+        case PopupAttachmentType::Document:
+          return QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/file.svg");
+        case PopupAttachmentType::Other:
+          [[fallthrough]];
+        default:
+          return QStringLiteral(":/Esri/ArcGISRuntime/Toolkit/other.svg");
+      }
+    }
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::PopupAttachmentThumbnailCache
+    \brief A process-wide cache of popup attachment thumbnails and file type icons.
+
+    Image attachments are decoded straight to thumbnail size on the global thread pool, and the
+    results kept in memory within a budget. Icons are rendered once per MIME type.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  PopupAttachmentThumbnailCache* PopupAttachmentThumbnailCache::instance()
+  {
+    static PopupAttachmentThumbnailCache self;
+    return &self;
+  }
+
+  PopupAttachmentThumbnailCache::PopupAttachmentThumbnailCache() :
+    m_thumbnails(32 * 1024 * 1024)
+  {
+  }
+
+  /*!
+    \brief Returns the size image attachments are decoded to fit within.
+   */
+  QSize PopupAttachmentThumbnailCache::thumbnailSize()
+  {
+    return QSize(256, 256);
+  }
+
+  /*!
+    \brief Returns the size of the icons shown for attachments without a thumbnail.
+   */
+  QSize PopupAttachmentThumbnailCache::iconSize()
+  {
+    return QSize(32, 32);
+  }
+
+  /*!
+    \brief Returns the thumbnail of the image file at \a filePath.
+
+    The result is ready straight away if the thumbnail is cached. Otherwise the file is decoded
+    at thumbnail size on a worker thread, and the result is null if it could not be read.
+   */
+  QFuture<QImage> PopupAttachmentThumbnailCache::thumbnail(const QString& filePath)
+  {
+    QMutexLocker locker(&m_mutex);
+
+    if (const auto* image = m_thumbnails.object(filePath))
+    {
+      QPromise<QImage> promise;
+      auto future = promise.future();
+      promise.start();
+      promise.addResult(*image);
+      promise.finish();
+      return future;
+    }
+
+    if (const auto it = m_pendingThumbnails.constFind(filePath); it != m_pendingThumbnails.cend())
+    {
+      return it.value();
+    }
+
+    auto promise = std::make_shared<QPromise<QImage>>();
+    auto future = promise->future();
+    m_pendingThumbnails.insert(filePath, future);
+
+    QThreadPool::globalInstance()->start([this, promise, filePath]()
+    {
+      promise->start();
+
+      QImageReader reader(filePath);
+      reader.setAutoTransform(true);
+      const auto size = reader.size();
+      if (size.isValid() && (size.width() > thumbnailSize().width() || size.height() > thumbnailSize().height()))
+      {
+        // only the pixels the thumbnail needs are decoded, for formats which support it
+        reader.setScaledSize(size.scaled(thumbnailSize(), Qt::KeepAspectRatio));
+      }
+
+      const auto image = reader.read();
+      {
+        QMutexLocker locker(&m_mutex);
+        m_pendingThumbnails.remove(filePath);
+        if (!image.isNull())
+        {
+          m_thumbnails.insert(filePath, new QImage(image), image.sizeInBytes());
+        }
+      }
+
+      promise->addResult(image);
+      promise->finish();
+    });
+
+    return future;
+  }
+
+  /*!
+    \brief Returns the icon for the attachment at \a filePath, with the MIME type \a contentType
+    and of type \a popupAttachmentType.
+
+    Icons are cached by MIME type, which is looked up from the file when \a contentType is empty.
+   */
+  QImage PopupAttachmentThumbnailCache::icon(const QString& filePath, const QString& contentType, PopupAttachmentType popupAttachmentType)
+  {
+    const auto mimeType = contentType.isEmpty() ? QMimeDatabase().mimeTypeForFile(filePath).name() : contentType;
+
+    QMutexLocker locker(&m_mutex);
+    if (const auto it = m_icons.constFind(mimeType); it != m_icons.cend())
+    {
+      return it.value();
+    }
+
+    QImage image;
+#if !defined(Q_OS_IOS) && !defined(Q_OS_ANDROID)
+    image = QAbstractFileIconProvider().icon(QFileInfo(filePath)).pixmap(iconSize()).toImage();
+#endif
+
+    // Handles edge case for Mobile since QAbstractFileIconProvider returns a Null QIcon.
+    if (image.isNull())
+    {
+      // QSvgRenderer, unlike QIcon, does not need the GUI thread
+      image = QImage(iconSize(), QImage::Format_ARGB32_Premultiplied);
+      image.fill(Qt::transparent);
+      QSvgRenderer renderer(iconPath(popupAttachmentType));
+      QPainter painter(&image);
+      renderer.render(&painter);
+    }
+
+    m_icons.insert(mimeType, image);
+    return image;
+  }
+
+  /*!
+    \brief Returns the maximum number of bytes of thumbnails kept in memory. Defaults to 32 MB.
+   */
+  qint64 PopupAttachmentThumbnailCache::maximumBytes() const
+  {
+    QMutexLocker locker(&m_mutex);
+    return m_thumbnails.maxCost();
+  }
+
+  void PopupAttachmentThumbnailCache::setMaximumBytes(qint64 maximumBytes)
+  {
+    QMutexLocker locker(&m_mutex);
+    m_thumbnails.setMaxCost(maximumBytes);
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPATTACHMENTTHUMBNAILCACHE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPATTACHMENTTHUMBNAILCACHE_H
+
+// Qt headers
+#include <QCache>
+#include <QFuture>
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QSize>
+#include <QString>
+
+// Other headers
+#include "QmlEnums.h"
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class PopupAttachmentThumbnailCache
+  {
+  public:
+    static PopupAttachmentThumbnailCache* instance();
+
+    static QSize thumbnailSize();
+
+    static QSize iconSize();
+
+    QFuture<QImage> thumbnail(const QString& filePath);
+
+    QImage icon(const QString& filePath, const QString& contentType, PopupAttachmentType popupAttachmentType);
+
+    qint64 maximumBytes() const;
+    void setMaximumBytes(qint64 maximumBytes);
+
+  private:
+    PopupAttachmentThumbnailCache();
+
+    mutable QMutex m_mutex;
+    QCache<QString, QImage> m_thumbnails;
+    // decodes in flight, so concurrent requests for the same file share one
+    QHash<QString, QFuture<QImage>> m_pendingThumbnails;
+    QHash<QString, QImage> m_icons;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPATTACHMENTTHUMBNAILCACHE_H
@@ -38,7 +38,8 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   QmlEnums::PopupElementType PopupElementViewItem::popupElementType() const
   {
-    return static_cast<QmlEnums::PopupElementType>(m_popupElement->popupElementType());
+    return m_popupElement ? static_cast<QmlEnums::PopupElementType>(m_popupElement->popupElementType())
+                          : QmlEnums::PopupElementType::PopupElementTypeUnknown;
   }
 
   PopupElement* PopupElementViewItem::popupElement() const
@@ -62,7 +63,12 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     if (m_popupElement)
     {
-      connect(m_popupElement, &QObject::destroyed, this, &PopupElementViewItem::popupElementChanged);
+      connect(m_popupElement, &QObject::destroyed, this, [this]()
+      {
+        // nothing must read the element while it is being destroyed
+        m_popupElement = nullptr;
+        emit popupElementChanged();
+      });
     }
 
     emit popupElementChanged();
@@ -46,7 +46,7 @@ namespace Esri::ArcGISRuntime
 
       QmlEnums::PopupElementType popupElementType() const;
       PopupElement* popupElement() const;
-      void setPopupElement(PopupElement* popupElement);
+      virtual void setPopupElement(PopupElement* popupElement);
 
     signals:
       void popupElementChanged();
@@ -39,27 +39,43 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   QString PopupMediaItem::alternativeText() const
   {
-    return m_popupMedia->alternativeText();
+    return m_popupMedia ? m_popupMedia->alternativeText() : QString{};
   }
 
   QString PopupMediaItem::title() const
   {
-    return m_popupMedia->title();
+    return m_popupMedia ? m_popupMedia->title() : QString{};
   }
 
   QString PopupMediaItem::caption() const
   {
-    return m_popupMedia->caption();
+    return m_popupMedia ? m_popupMedia->caption() : QString{};
   }
 
   PopupMediaType PopupMediaItem::popupMediaType() const
   {
-    return m_popupMedia->popupMediaType();
+    return m_popupMedia ? m_popupMedia->popupMediaType() : PopupMediaType::Unknown;
   }
 
   PopupMedia* PopupMediaItem::popupMediaItem() const
   {
-    return m_popupMedia;
+    return m_popupMedia.data();
+  }
+
+  /*!
+    \internal
+    Rebinds this item to \a popupMedia, so the item can be recycled when the popup changes. A \c nullptr
+    unbinds the item while it is pooled.
+   */
+  void PopupMediaItem::setPopupMedia(PopupMedia* popupMedia)
+  {
+    if (m_popupMedia == popupMedia)
+    {
+      return;
+    }
+
+    m_popupMedia = popupMedia;
+    emit popupMediaItemChanged();
   }
 
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -18,6 +18,7 @@
 
 // Qt headers
 #include <QObject>
+#include <QPointer>
 
 // Other headers
 #include "QmlEnums.h"
@@ -54,12 +55,14 @@ namespace Esri::ArcGISRuntime
 
     public:
       PopupMedia* popupMediaItem() const;
+      virtual void setPopupMedia(PopupMedia* popupMedia);
 
     signals:
       void popupMediaItemChanged();
 
     private:
-      PopupMedia* m_popupMedia = nullptr;
+      // null while the item is pooled, and once the popup owning the media has been deleted
+      QPointer<PopupMedia> m_popupMedia;
     };
 
   } // namespace Toolkit
@@ -0,0 +1,303 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "PopupPrefetcher.h"
+
+// Maps SDK headers
+#include <AttachmentsPopupElement.h>
+#include <FieldsPopupElement.h>
+#include <Popup.h>
+#include <PopupDefinition.h>
+#include <PopupElement.h>
+#include <PopupExpressionEvaluation.h>
+#include <PopupTypes.h>
+#include <TextPopupElement.h>
+
+// Qt headers
+#include <QFuture>
+
+// std headers
+#include <algorithm>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    // Rough per-object costs used to keep prefetched content within its memory budget.
+    constexpr qint64 bytesPerPopup = 4096;
+    constexpr qint64 bytesPerElement = 512;
+    constexpr qint64 bytesPerAttachment = 1024;
+
+    qint64 stringBytes(const QStringList& strings)
+    {
+      qint64 bytes = 0;
+      for (const auto& string : strings)
+      {
+        bytes += string.size() * static_cast<qint64>(sizeof(QChar));
+      }
+      return bytes;
+    }
+
+    qint64 estimatedBytes(Popup* popup)
+    {
+      qint64 bytes = bytesPerPopup;
+      for (auto* element : popup->evaluatedElements())
+      {
+        bytes += bytesPerElement;
+        switch (element->popupElementType())
+        {
+          case PopupElementType::TextPopupElement:
+            bytes += stringBytes({static_cast<TextPopupElement*>(element)->text()});
+            break;
+          case PopupElementType::FieldsPopupElement:
+            bytes += stringBytes(static_cast<FieldsPopupElement*>(element)->labels());
+            bytes += stringBytes(static_cast<FieldsPopupElement*>(element)->formattedValues());
+            break;
+          default:
+            break;
+        }
+      }
+      return bytes;
+    }
+
+    // Counted for a popup from when its prefetch starts until it has been evaluated, so a whole window
+    // of prefetches cannot be started before any of them counts against the budget.
+    qint64 reservedBytes(Popup* popup)
+    {
+      const auto* definition = popup->popupDefinition();
+      return bytesPerPopup + (definition ? definition->elements().size() * bytesPerElement : 0);
+    }
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::PopupPrefetcher
+    \brief Evaluates the popups either side of the one displayed, so paging to them binds without waiting.
+
+    Expressions are evaluated and attachment metadata is fetched for up to \l prefetchCount popups after
+    and before the current popup, nearest first, until the estimated size of the prefetched content
+    reaches \l maximumBytes.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  PopupPrefetcher::PopupPrefetcher(QObject* parent) :
+    QObject(parent)
+  {
+  }
+
+  PopupPrefetcher::~PopupPrefetcher() = default;
+
+  /*!
+    \brief Sets the list of \a popups the user pages through.
+   */
+  void PopupPrefetcher::setPopups(const QList<Popup*>& popups)
+  {
+    m_popups.clear();
+    m_popups.reserve(popups.size());
+    for (auto* popup : popups)
+    {
+      m_popups.append(popup);
+    }
+
+    const auto prefetchedPopups = m_entries.keys();
+    for (auto* popup : prefetchedPopups)
+    {
+      if (!popups.contains(popup))
+      {
+        forget(popup);
+      }
+    }
+
+    prefetchAroundCurrentPopup();
+  }
+
+  /*!
+    \brief Sets the \a popup being displayed and prefetches its neighbors in the list of popups.
+   */
+  void PopupPrefetcher::setCurrentPopup(Popup* popup)
+  {
+    m_currentPopup = popup;
+    prefetchAroundCurrentPopup();
+  }
+
+  /*!
+    \brief Returns \c true if the expressions of \a popup have been evaluated by this prefetcher.
+   */
+  bool PopupPrefetcher::isEvaluated(Popup* popup) const
+  {
+    const auto it = m_entries.constFind(popup);
+    return it != m_entries.cend() && it->isEvaluated;
+  }
+
+  /*!
+    \brief Returns the number of popups prefetched either side of the current popup. Defaults to 2.
+   */
+  int PopupPrefetcher::prefetchCount() const
+  {
+    return m_prefetchCount;
+  }
+
+  void PopupPrefetcher::setPrefetchCount(int prefetchCount)
+  {
+    m_prefetchCount = std::max(0, prefetchCount);
+    prefetchAroundCurrentPopup();
+  }
+
+  /*!
+    \brief Returns the approximate size in bytes above which no more popups are prefetched. Defaults to 16 MB.
+   */
+  qint64 PopupPrefetcher::maximumBytes() const
+  {
+    return m_maximumBytes;
+  }
+
+  void PopupPrefetcher::setMaximumBytes(qint64 maximumBytes)
+  {
+    m_maximumBytes = maximumBytes;
+    prefetchAroundCurrentPopup();
+  }
+
+  void PopupPrefetcher::prefetchAroundCurrentPopup()
+  {
+    const auto index = m_popups.indexOf(m_currentPopup);
+    if (index < 0)
+    {
+      return;
+    }
+
+    // popups which have left the window no longer count against the budget
+    const auto first = std::max<qsizetype>(0, index - m_prefetchCount);
+    const auto last = std::min<qsizetype>(m_popups.size() - 1, index + m_prefetchCount);
+    const auto prefetchedPopups = m_entries.keys();
+    for (auto* popup : prefetchedPopups)
+    {
+      const auto popupIndex = m_popups.indexOf(popup);
+      if (popupIndex < first || popupIndex > last)
+      {
+        forget(popup);
+      }
+    }
+
+    // paging forward is the most common, so the next popup comes before the previous one at each distance
+    for (int distance = 1; distance <= m_prefetchCount; ++distance)
+    {
+      for (const auto popupIndex : {index + distance, index - distance})
+      {
+        if (m_totalBytes >= m_maximumBytes)
+        {
+          return;
+        }
+
+        if (popupIndex >= 0 && popupIndex < m_popups.size())
+        {
+          prefetch(m_popups.at(popupIndex));
+        }
+      }
+    }
+  }
+
+  void PopupPrefetcher::prefetch(Popup* popup)
+  {
+    if (!popup || m_entries.contains(popup))
+    {
+      return;
+    }
+
+    const auto bytes = reservedBytes(popup);
+    m_entries.insert(popup, Entry{false, bytes});
+    m_totalBytes += bytes;
+    connect(popup, &QObject::destroyed, this, [this, popup]()
+    {
+      forget(popup);
+    });
+
+    QPointer<Popup> guardedPopup(popup);
+    popup->evaluateExpressionsAsync(popup).then(this, [this, guardedPopup](const QList<PopupExpressionEvaluation*>&)
+    {
+      if (guardedPopup)
+      {
+        onEvaluated(guardedPopup);
+      }
+    })
+      .onFailed(this, [this, guardedPopup]()
+    {
+      // forgotten, so it is tried again the next time the window reaches it
+      if (guardedPopup)
+      {
+        forget(guardedPopup);
+      }
+    });
+  }
+
+  void PopupPrefetcher::onEvaluated(Popup* popup)
+  {
+    auto it = m_entries.find(popup);
+    if (it == m_entries.end())
+    {
+      // left the window while it was being evaluated
+      return;
+    }
+
+    // replaces the bytes reserved when the prefetch started
+    const auto bytes = estimatedBytes(popup);
+    m_totalBytes += bytes - it->estimatedBytes;
+    it->isEvaluated = true;
+    it->estimatedBytes = bytes;
+
+    QPointer<Popup> guardedPopup(popup);
+    for (auto* element : popup->evaluatedElements())
+    {
+      if (element->popupElementType() != PopupElementType::AttachmentsPopupElement)
+      {
+        continue;
+      }
+
+      auto* attachmentsPopupElement = static_cast<AttachmentsPopupElement*>(element);
+      attachmentsPopupElement->fetchAttachmentsAsync().then(this, [this, guardedPopup, attachmentsPopupElement]()
+      {
+        if (!guardedPopup)
+        {
+          return;
+        }
+
+        auto entry = m_entries.find(guardedPopup);
+        if (entry == m_entries.end())
+        {
+          return;
+        }
+
+        const auto bytes = attachmentsPopupElement->attachments().size() * bytesPerAttachment;
+        entry->estimatedBytes += bytes;
+        m_totalBytes += bytes;
+      });
+    }
+  }
+
+  void PopupPrefetcher::forget(Popup* popup)
+  {
+    const auto it = m_entries.constFind(popup);
+    if (it == m_entries.cend())
+    {
+      return;
+    }
+
+    m_totalBytes -= it->estimatedBytes;
+    m_entries.erase(it);
+    disconnect(popup, &QObject::destroyed, this, nullptr);
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
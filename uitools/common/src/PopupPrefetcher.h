@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPPREFETCHER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPPREFETCHER_H
+
+// Qt headers
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+
+namespace Esri::ArcGISRuntime
+{
+  class Popup;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class PopupPrefetcher : public QObject
+  {
+    Q_OBJECT
+
+  public:
+    explicit PopupPrefetcher(QObject* parent = nullptr);
+    ~PopupPrefetcher() override;
+
+    void setPopups(const QList<Popup*>& popups);
+
+    void setCurrentPopup(Popup* popup);
+
+    bool isEvaluated(Popup* popup) const;
+
+    int prefetchCount() const;
+    void setPrefetchCount(int prefetchCount);
+
+    qint64 maximumBytes() const;
+    void setMaximumBytes(qint64 maximumBytes);
+
+  private:
+    void prefetchAroundCurrentPopup();
+    void prefetch(Popup* popup);
+    void onEvaluated(Popup* popup);
+    void forget(Popup* popup);
+
+    struct Entry
+    {
+      bool isEvaluated = false;
+      qint64 estimatedBytes = 0;
+    };
+
+    QList<QPointer<Popup>> m_popups;
+    QPointer<Popup> m_currentPopup;
+    // popups prefetched or being prefetched, those outside the prefetch window are forgotten
+    QHash<Popup*, Entry> m_entries;
+    qint64 m_totalBytes = 0;
+    qint64 m_maximumBytes = 16 * 1024 * 1024;
+    int m_prefetchCount = 2;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_POPUPPREFETCHER_H
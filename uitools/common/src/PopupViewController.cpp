@@ -22,6 +22,8 @@
 #include <QAbstractListModel>
 #include <QDebug>
 #include <QFuture>
+#include <QMultiHash>
+#include <QTimer>
 
 // Maps SDK headers
 #include "AttachmentsPopupElement.h"
@@ -40,7 +42,9 @@
 #include "AttachmentsPopupElementViewController.h"
 #include "FieldsPopupElementViewController.h"
 #include "MediaPopupElementViewController.h"
+#include "PopupAttachmentDownloadScheduler.h"
 #include "PopupElementViewItem.h"
+#include "PopupPrefetcher.h"
 #include "TextPopupElementViewController.h"
 
 namespace Esri::ArcGISRuntime::Toolkit
@@ -48,10 +52,8 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   namespace
   {
-    bool isReusableElementType(PopupElementType type)
-    {
-      return type == PopupElementType::TextPopupElement || type == PopupElementType::FieldsPopupElement;
-    }
+    // Recycled controllers kept for later popups, beyond those displayed.
+    constexpr qsizetype maximumRecycledControllers = 8;
 
     PopupElementViewItem* popupElementViewItemAt(GenericListModel* model, int index)
     {
@@ -72,8 +74,7 @@ namespace Esri::ArcGISRuntime::Toolkit
         const auto newType = evaluatedElements.at(i)->popupElementType();
 
         if (!existingItem ||
-            existingItem->popupElementType() != static_cast<QmlEnums::PopupElementType>(newType) ||
-            !isReusableElementType(newType))
+            existingItem->popupElementType() != static_cast<QmlEnums::PopupElementType>(newType))
         {
           return false;
         }
@@ -98,25 +99,59 @@ namespace Esri::ArcGISRuntime::Toolkit
       }
     }
 
-    void appendControllerForElement(GenericListModel* model, PopupElement* element, PopupViewController* controller, Popup* popup)
+    // The evaluated content an element's controller displays, used to skip notifying unchanged controllers.
+    QStringList elementContent(PopupElement* element)
     {
       switch (element->popupElementType())
       {
         case PopupElementType::TextPopupElement:
-          model->append(new TextPopupElementViewController(static_cast<TextPopupElement*>(element), controller, popup));
-          break;
+          return {static_cast<TextPopupElement*>(element)->text()};
         case PopupElementType::FieldsPopupElement:
-          model->append(new FieldsPopupElementViewController(static_cast<FieldsPopupElement*>(element), controller, popup));
-          break;
+        {
+          auto* fieldsElement = static_cast<FieldsPopupElement*>(element);
+          QStringList content{fieldsElement->title(), fieldsElement->description()};
+          content.append(fieldsElement->labels());
+          content.append(fieldsElement->formattedValues());
+          return content;
+        }
+        default:
+          return {};
+      }
+    }
+
+    // The class of controller displaying elements of type \a type, or nullptr if the type is not supported.
+    const QMetaObject* controllerTypeForElementType(PopupElementType type)
+    {
+      switch (type)
+      {
+        case PopupElementType::TextPopupElement:
+          return &TextPopupElementViewController::staticMetaObject;
+        case PopupElementType::FieldsPopupElement:
+          return &FieldsPopupElementViewController::staticMetaObject;
         case PopupElementType::AttachmentsPopupElement:
-          model->append(new AttachmentsPopupElementViewController(static_cast<AttachmentsPopupElement*>(element), controller, popup));
-          break;
+          return &AttachmentsPopupElementViewController::staticMetaObject;
         case PopupElementType::MediaPopupElement:
-          model->append(new MediaPopupElementViewController(static_cast<MediaPopupElement*>(element), controller, popup));
-          break;
+          return &MediaPopupElementViewController::staticMetaObject;
+        default:
+          return nullptr;
+      }
+    }
+
+    PopupElementViewItem* createControllerForElement(PopupElement* element, PopupViewController* controller)
+    {
+      switch (element->popupElementType())
+      {
+        case PopupElementType::TextPopupElement:
+          return new TextPopupElementViewController(static_cast<TextPopupElement*>(element), controller, controller);
+        case PopupElementType::FieldsPopupElement:
+          return new FieldsPopupElementViewController(static_cast<FieldsPopupElement*>(element), controller, controller);
+        case PopupElementType::AttachmentsPopupElement:
+          return new AttachmentsPopupElementViewController(static_cast<AttachmentsPopupElement*>(element), controller, controller);
+        case PopupElementType::MediaPopupElement:
+          return new MediaPopupElementViewController(static_cast<MediaPopupElement*>(element), controller, controller);
         default:
           Q_UNIMPLEMENTED();
-          break;
+          return nullptr;
       }
     }
   } // namespace
@@ -128,12 +163,14 @@ namespace Esri::ArcGISRuntime::Toolkit
 
   PopupViewController::PopupViewController(QObject* parent) :
     QObject(parent),
-    m_popupElementControllerModel(new GenericListModel(&PopupElementViewItem::staticMetaObject, this))
+    m_popupElementControllerModel(new GenericListModel(&PopupElementViewItem::staticMetaObject, this)),
+    m_popupPrefetcher(new PopupPrefetcher(this))
   {
   }
 
   PopupViewController::~PopupViewController()
   {
+    PopupAttachmentDownloadScheduler::instance()->cancel(this);
   }
 
   Popup* PopupViewController::popup() const
@@ -155,49 +192,170 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
   }
 
+  /*!
+    \internal
+    \brief Requests a refresh of the popup content.
+
+    Requests made within the same pass of the event loop, such as a burst of attribute updates,
+    are coalesced into a single evaluation of the popup expressions.
+   */
+  void PopupViewController::scheduleRefreshPopupContent_()
+  {
+    if (m_isRefreshScheduled)
+    {
+      return;
+    }
+
+    m_isRefreshScheduled = true;
+    QTimer::singleShot(0, this, [this]()
+    {
+      // a direct refresh may have happened in the meantime
+      if (!m_isRefreshScheduled)
+      {
+        return;
+      }
+
+      refreshPopupContent_();
+    });
+  }
+
   void PopupViewController::refreshPopupContent_()
   {
+    m_isRefreshScheduled = false;
+
+    // continuations of evaluations started before this one are stale and are dropped
+    const auto generation = ++m_refreshGeneration;
+
     if (!m_popup)
     {
       return;
     }
 
-    m_popup->evaluateExpressionsAsync(this).then(this, [this](const QList<PopupExpressionEvaluation*>&)
+    m_popup->evaluateExpressionsAsync(this).then(this, [this, generation](const QList<PopupExpressionEvaluation*>&)
     {
-      if (!m_popup)
+      if (!m_popup || generation != m_refreshGeneration)
       {
         return;
       }
 
-      const auto evaluatedElements = m_popup->evaluatedElements();
-      const bool canReuseControllers = canReuseControllersForElements(m_popupElementControllerModel, evaluatedElements);
+      updateControllers_();
+    });
+  }
+
+  /*!
+    \internal
+    \brief Binds the element controllers to the evaluated elements of the popup.
+   */
+  void PopupViewController::updateControllers_()
+  {
+    const auto evaluatedElements = m_popup->evaluatedElements();
+    // when the elements line up with the current controllers they are rebound in place, which attachment
+    // and media controllers use to diff their own items
+    const bool canReuseControllers = canReuseControllersForElements(m_popupElementControllerModel, evaluatedElements) &&
+                                     m_elementContents.size() == evaluatedElements.size();
 
-      if (canReuseControllers)
+    if (canReuseControllers)
+    {
+      for (int i = 0; i < evaluatedElements.size(); ++i)
       {
-        for (int i = 0; i < evaluatedElements.size(); ++i)
-        {
-          auto* existingObject = m_popupElementControllerModel->element(m_popupElementControllerModel->index(i, 0));
-          auto* existingItem = popupElementViewItemAt(m_popupElementControllerModel, i);
-          auto* newElement = evaluatedElements.at(i);
+        auto* existingObject = m_popupElementControllerModel->element(m_popupElementControllerModel->index(i, 0));
+        auto* existingItem = popupElementViewItemAt(m_popupElementControllerModel, i);
+        auto* newElement = evaluatedElements.at(i);
 
-          existingItem->setPopupElement(newElement);
-          notifyControllerChanged(existingObject, newElement->popupElementType());
+        existingItem->setPopupElement(newElement);
+
+        auto content = elementContent(newElement);
+        if (content == m_elementContents.at(i))
+        {
+          continue;
         }
+
+        m_elementContents[i] = std::move(content);
+        notifyControllerChanged(existingObject, newElement->popupElementType());
       }
-      else
-      {
-        m_popupElementControllerModel->removeRows(0, m_popupElementControllerModel->rowCount());
+    }
+    else
+    {
+      recycleControllers_();
+      m_elementContents.reserve(evaluatedElements.size());
 
-        for (auto* const element : evaluatedElements)
+      for (auto* const element : evaluatedElements)
+      {
+        if (auto* controller = takeRecycledController_(element))
         {
-          appendControllerForElement(m_popupElementControllerModel, element, this, m_popup);
+          m_popupElementControllerModel->append(controller);
+          m_elementContents.append(elementContent(element));
         }
       }
 
-      emit popupChanged();
-      emit titleChanged();
-      emit editSummaryChanged();
-    });
+      trimRecycledControllers_();
+    }
+
+    emit popupChanged();
+    emit titleChanged();
+    emit editSummaryChanged();
+  }
+
+  /*!
+    \internal
+    \brief Moves the displayed element controllers into the recycling pool, keyed by controller class.
+
+    Pooled controllers are unbound from their elements, which may be deleted along with their popup.
+   */
+  void PopupViewController::recycleControllers_()
+  {
+    QList<PopupElementViewItem*> controllers;
+    controllers.reserve(m_popupElementControllerModel->rowCount());
+    for (int i = 0; i < m_popupElementControllerModel->rowCount(); ++i)
+    {
+      controllers.append(popupElementViewItemAt(m_popupElementControllerModel, i));
+    }
+
+    // the controllers are not owned by the model, so this does not delete them
+    m_popupElementControllerModel->removeRows(0, m_popupElementControllerModel->rowCount());
+    m_elementContents.clear();
+
+    for (auto* controller : std::as_const(controllers))
+    {
+      if (!controller)
+      {
+        continue;
+      }
+
+      controller->setPopupElement(nullptr);
+      m_recycledControllers.insert(controller->metaObject(), controller);
+    }
+  }
+
+  /*!
+    \internal
+    \brief Returns a pooled controller rebound to \a element, or a new controller if none of its class is pooled.
+   */
+  PopupElementViewItem* PopupViewController::takeRecycledController_(PopupElement* element)
+  {
+    const auto type = element->popupElementType();
+    auto* controller = m_recycledControllers.take(controllerTypeForElementType(type));
+    if (!controller)
+    {
+      return createControllerForElement(element, this);
+    }
+
+    controller->setPopupElement(element);
+    if (type == PopupElementType::TextPopupElement || type == PopupElementType::FieldsPopupElement)
+    {
+      notifyControllerChanged(controller, type);
+    }
+    return controller;
+  }
+
+  void PopupViewController::trimRecycledControllers_()
+  {
+    while (m_recycledControllers.size() > maximumRecycledControllers)
+    {
+      auto it = m_recycledControllers.begin();
+      delete it.value();
+      m_recycledControllers.erase(it);
+    }
   }
 
   void PopupViewController::setPopup(Popup* popup)
@@ -209,12 +367,16 @@ namespace Esri::ArcGISRuntime::Toolkit
 
     if (m_popup)
     {
+      // attachments of the old popup are no longer wanted
+      PopupAttachmentDownloadScheduler::instance()->cancel(this);
       disconnect(m_popup.data(), nullptr, this, nullptr);
       disconnectAttributeModelSignal_();
-      m_popupElementControllerModel->removeRows(0, m_popupElementControllerModel->rowCount());
+      // the controllers are kept to be rebound to the elements of the new popup
+      recycleControllers_();
     }
 
     m_popup = popup;
+    m_popupPrefetcher->setCurrentPopup(popup);
 
     if (m_popup)
     {
@@ -228,12 +390,21 @@ namespace Esri::ArcGISRuntime::Toolkit
           // If the attributes model starts emitting more fine grained signals for attribute updates in the future, this can be updated to listen for those.
           m_attributeModelConnection = connect(attributes, &QAbstractItemModel::modelReset, this, [this]()
           {
-            refreshPopupContent_();
+            scheduleRefreshPopupContent_();
           });
         }
       }
     }
 
+    if (m_popup && m_popupPrefetcher->isEvaluated(m_popup))
+    {
+      // the prefetcher has evaluated the expressions already, so the content is bound without waiting
+      m_isRefreshScheduled = false;
+      ++m_refreshGeneration;
+      updateControllers_();
+      return;
+    }
+
     refreshPopupContent_();
 
     emit popupChanged();
@@ -251,4 +422,92 @@ namespace Esri::ArcGISRuntime::Toolkit
     return m_popup ? m_popup->editSummary() : QString{};
   }
 
+  /*!
+    \internal
+    Returns the size in bytes above which attachment data is not emitted through \c attachmentDataFetched.
+    Those attachments emit \c attachmentFileFetched with the local file the data was saved to instead,
+    so the data is not forwarded to handlers which would copy it. It is still downloaded into memory
+    in full, and released once the download has been handled. Defaults to -1, which emits the data
+    of every attachment.
+   */
+  qint64 PopupViewController::attachmentDataSizeLimit() const
+  {
+    return m_attachmentDataSizeLimit;
+  }
+
+  void PopupViewController::setAttachmentDataSizeLimit(qint64 attachmentDataSizeLimit)
+  {
+    if (m_attachmentDataSizeLimit == attachmentDataSizeLimit)
+    {
+      return;
+    }
+
+    m_attachmentDataSizeLimit = attachmentDataSizeLimit;
+    emit attachmentDataSizeLimitChanged();
+  }
+
+  /*!
+    \internal
+    Sets the list of \a popups the user pages through, such as the results of an identify.
+
+    While one of these popups is displayed, the expressions of the popups after and before it are
+    evaluated and their attachment metadata is fetched in the background, so setting \l popup to
+    one of them binds its content without waiting.
+   */
+  void PopupViewController::prefetchPopups(const QList<QObject*>& popups)
+  {
+    QList<Popup*> popupList;
+    popupList.reserve(popups.size());
+    for (auto* object : popups)
+    {
+      if (auto* popup = qobject_cast<Popup*>(object))
+      {
+        popupList.append(popup);
+      }
+    }
+
+    m_popupPrefetcher->setPopups(popupList);
+  }
+
+  /*!
+    \internal
+    Returns the number of popups prefetched either side of the displayed popup. Defaults to 2, 0 disables prefetching.
+   */
+  int PopupViewController::popupPrefetchCount() const
+  {
+    return m_popupPrefetcher->prefetchCount();
+  }
+
+  void PopupViewController::setPopupPrefetchCount(int popupPrefetchCount)
+  {
+    if (m_popupPrefetcher->prefetchCount() == popupPrefetchCount)
+    {
+      return;
+    }
+
+    m_popupPrefetcher->setPrefetchCount(popupPrefetchCount);
+    emit popupPrefetchCountChanged();
+  }
+
+  /*!
+    \internal
+    Returns the approximate size in bytes of prefetched popup content above which no more popups are prefetched.
+    Defaults to 16 MB.
+   */
+  qint64 PopupViewController::popupPrefetchBudget() const
+  {
+    return m_popupPrefetcher->maximumBytes();
+  }
+
+  void PopupViewController::setPopupPrefetchBudget(qint64 popupPrefetchBudget)
+  {
+    if (m_popupPrefetcher->maximumBytes() == popupPrefetchBudget)
+    {
+      return;
+    }
+
+    m_popupPrefetcher->setMaximumBytes(popupPrefetchBudget);
+    emit popupPrefetchBudgetChanged();
+  }
+
 } // namespace Esri::ArcGISRuntime::Toolkit
@@ -19,8 +19,10 @@
 // Qt headers
 #include <QAbstractListModel>
 #include <QMetaObject>
+#include <QMultiHash>
 #include <QObject>
 #include <QPointer>
+#include <QStringList>
 
 // STL headers
 #include <Deprecated.h>
@@ -36,6 +38,9 @@ namespace Esri::ArcGISRuntime
   namespace Toolkit
   {
 
+    class PopupElementViewItem;
+    class PopupPrefetcher;
+
     class PopupViewController : public QObject
     {
       Q_OBJECT
@@ -43,6 +48,9 @@ namespace Esri::ArcGISRuntime
       Q_PROPERTY(QString title READ title NOTIFY titleChanged)
       Q_PROPERTY(QString editSummary READ editSummary NOTIFY editSummaryChanged)
       Q_PROPERTY(QAbstractListModel* popupElementControllers READ popupElementControllers NOTIFY popupChanged)
+      Q_PROPERTY(qint64 attachmentDataSizeLimit READ attachmentDataSizeLimit WRITE setAttachmentDataSizeLimit NOTIFY attachmentDataSizeLimitChanged)
+      Q_PROPERTY(int popupPrefetchCount READ popupPrefetchCount WRITE setPopupPrefetchCount NOTIFY popupPrefetchCountChanged)
+      Q_PROPERTY(qint64 popupPrefetchBudget READ popupPrefetchBudget WRITE setPopupPrefetchBudget NOTIFY popupPrefetchBudgetChanged)
 
     public:
       Q_INVOKABLE explicit PopupViewController(QObject* parent = nullptr);
@@ -58,6 +66,17 @@ namespace Esri::ArcGISRuntime
       QString title() const;
       QString editSummary() const;
 
+      qint64 attachmentDataSizeLimit() const;
+      void setAttachmentDataSizeLimit(qint64 attachmentDataSizeLimit);
+
+      Q_INVOKABLE void prefetchPopups(const QList<QObject*>& popups);
+
+      int popupPrefetchCount() const;
+      void setPopupPrefetchCount(int popupPrefetchCount);
+
+      qint64 popupPrefetchBudget() const;
+      void setPopupPrefetchBudget(qint64 popupPrefetchBudget);
+
     signals:
 
       void popupChanged();
@@ -68,17 +87,38 @@ namespace Esri::ArcGISRuntime
 
       void attachmentDataFetched(const QByteArray& attachmentData, const QString& name);
 
+      void attachmentFileFetched(const QUrl& localData, const QString& name);
+
+      void attachmentDataSizeLimitChanged();
+
+      void popupPrefetchCountChanged();
+
+      void popupPrefetchBudgetChanged();
+
       void clickedUrl(const QUrl& url);
 
       void imageClicked(const QUrl& sourceUrl, const QUrl& linkUrl);
 
     private:
+      void scheduleRefreshPopupContent_();
       void refreshPopupContent_();
+      void updateControllers_();
       void disconnectAttributeModelSignal_();
+      void recycleControllers_();
+      PopupElementViewItem* takeRecycledController_(PopupElement* element);
+      void trimRecycledControllers_();
 
       QPointer<Popup> m_popup;
       GenericListModel* m_popupElementControllerModel = nullptr;
+      PopupPrefetcher* m_popupPrefetcher = nullptr;
       QMetaObject::Connection m_attributeModelConnection;
+      qint64 m_attachmentDataSizeLimit = -1;
+      // the content last shown by each reusable element controller
+      QList<QStringList> m_elementContents;
+      // controllers no longer displayed, waiting to be rebound to an element of the same type
+      QMultiHash<const QMetaObject*, PopupElementViewItem*> m_recycledControllers;
+      quint64 m_refreshGeneration = 0;
+      bool m_isRefreshScheduled = false;
     };
 
   } // namespace Toolkit
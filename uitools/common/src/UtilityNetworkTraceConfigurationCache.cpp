@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "UtilityNetworkTraceConfigurationCache.h"
+
+// ArcGISRuntime headers
+#include <UtilityNamedTraceConfiguration.h>
+#include <UtilityNetwork.h>
+
+// Qt headers
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+// std headers
+#include <algorithm>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    // bump when the layout of the file changes, files of other versions are ignored
+    constexpr int fileVersion = 1;
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::UtilityNetworkTraceConfigurationCache
+    \brief Remembers the named trace configurations of each utility network across refreshes and application runs.
+
+    Entries are keyed by the service URL of the utility network and persisted to a JSON file,
+    so the trace UI can list configurations before they have been queried from the service.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  UtilityNetworkTraceConfigurationCache::UtilityNetworkTraceConfigurationCache(const QString& filePath) :
+    m_filePath(filePath)
+  {
+  }
+
+  /*!
+    \brief Returns the file in the application's cache directory configurations are persisted to.
+   */
+  QString UtilityNetworkTraceConfigurationCache::defaultFilePath()
+  {
+    return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+      .filePath(QStringLiteral("UtilityNetworkTrace/traceConfigurations.json"));
+  }
+
+  /*!
+    \brief Returns the cache key of \a utilityNetwork, or an empty string if it cannot be cached.
+   */
+  QString UtilityNetworkTraceConfigurationCache::key(UtilityNetwork* utilityNetwork)
+  {
+    return utilityNetwork ? utilityNetwork->uri().toString() : QString{};
+  }
+
+  /*!
+    \brief Returns the configurations last stored under \a key, sorted by name.
+
+    The persisted file is read the first time this is called.
+   */
+  QList<UtilityNetworkTraceConfigurationCache::Configuration> UtilityNetworkTraceConfigurationCache::find(const QString& key)
+  {
+    if (!m_isLoaded)
+    {
+      load();
+    }
+
+    return m_configurations.value(key);
+  }
+
+  /*!
+    \brief Stores \a traceConfigurations under \a key, writing the file only if they differ from those already stored.
+   */
+  void UtilityNetworkTraceConfigurationCache::insert(const QString& key, const QList<UtilityNamedTraceConfiguration*>& traceConfigurations)
+  {
+    if (key.isEmpty())
+    {
+      return;
+    }
+
+    if (!m_isLoaded)
+    {
+      load();
+    }
+
+    QList<Configuration> configurations;
+    configurations.reserve(traceConfigurations.size());
+    for (const auto* traceConfiguration : traceConfigurations)
+    {
+      configurations.append({traceConfiguration->name(), traceConfiguration->globalId(), traceConfiguration->minimumStartingLocations()});
+    }
+
+    const auto it = m_configurations.constFind(key);
+    if (it != m_configurations.cend() &&
+        std::equal(it->cbegin(), it->cend(), configurations.cbegin(), configurations.cend(), [](const auto& a, const auto& b)
+    {
+      return a.name == b.name && a.globalId == b.globalId && a.minimumStartingLocations == b.minimumStartingLocations;
+    }))
+    {
+      return;
+    }
+
+    m_configurations.insert(key, configurations);
+    save();
+  }
+
+  void UtilityNetworkTraceConfigurationCache::load()
+  {
+    m_isLoaded = true;
+
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+      return;
+    }
+
+    const auto document = QJsonDocument::fromJson(file.readAll());
+    const auto root = document.object();
+    if (root.value(QStringLiteral("version")).toInt() != fileVersion)
+    {
+      return;
+    }
+
+    const auto networks = root.value(QStringLiteral("utilityNetworks")).toObject();
+    for (auto network = networks.begin(); network != networks.end(); ++network)
+    {
+      QList<Configuration> configurations;
+      const auto array = network.value().toArray();
+      for (const auto& value : array)
+      {
+        const auto object = value.toObject();
+        configurations.append({object.value(QStringLiteral("name")).toString(),
+                               QUuid::fromString(object.value(QStringLiteral("globalId")).toString()),
+                               static_cast<UtilityMinimumStartingLocations>(object.value(QStringLiteral("minimumStartingLocations")).toInt())});
+      }
+      m_configurations.insert(network.key(), configurations);
+    }
+  }
+
+  void UtilityNetworkTraceConfigurationCache::save() const
+  {
+    if (m_filePath.isEmpty())
+    {
+      return;
+    }
+
+    QJsonObject networks;
+    for (auto it = m_configurations.cbegin(); it != m_configurations.cend(); ++it)
+    {
+      QJsonArray array;
+      for (const auto& configuration : it.value())
+      {
+        array.append(QJsonObject{{QStringLiteral("name"), configuration.name},
+                                 {QStringLiteral("globalId"), configuration.globalId.toString(QUuid::WithoutBraces)},
+                                 {QStringLiteral("minimumStartingLocations"), static_cast<int>(configuration.minimumStartingLocations)}});
+      }
+      networks.insert(it.key(), array);
+    }
+
+    const QJsonObject root{{QStringLiteral("version"), fileVersion}, {QStringLiteral("utilityNetworks"), networks}};
+
+    QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+
+    // written to a temporary file first, so a crash never leaves a truncated cache behind
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) < 0 || !file.commit())
+    {
+      qDebug() << "Could not save trace configurations to" << m_filePath << file.errorString();
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
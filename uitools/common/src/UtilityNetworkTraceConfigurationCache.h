@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACECONFIGURATIONCACHE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACECONFIGURATIONCACHE_H
+
+// Qt headers
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QUuid>
+
+// STL headers
+#include <UtilityNetworkTypes.h>
+
+namespace Esri::ArcGISRuntime
+{
+  class UtilityNamedTraceConfiguration;
+  class UtilityNetwork;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class UtilityNetworkTraceConfigurationCache
+  {
+  public:
+    // What the trace UI needs to know about a named trace configuration before it has been queried.
+    struct Configuration
+    {
+      QString name;
+      QUuid globalId;
+      UtilityMinimumStartingLocations minimumStartingLocations = UtilityMinimumStartingLocations::One;
+    };
+
+    explicit UtilityNetworkTraceConfigurationCache(const QString& filePath = defaultFilePath());
+
+    static QString defaultFilePath();
+
+    static QString key(UtilityNetwork* utilityNetwork);
+
+    QList<Configuration> find(const QString& key);
+
+    void insert(const QString& key, const QList<UtilityNamedTraceConfiguration*>& traceConfigurations);
+
+  private:
+    void load();
+    void save() const;
+
+    QString m_filePath;
+    QHash<QString, QList<Configuration>> m_configurations;
+    bool m_isLoaded = false;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACECONFIGURATIONCACHE_H
@@ -29,21 +29,28 @@
 #include <Authentication/TokenCredential.h>
 #include <Error.h>
 #include <ErrorException.h>
+#include <FeatureIterator.h>
 #include <FeatureLayer.h>
+#include <FeatureQueryResult.h>
 #include <FeatureTable.h>
+#include <GeoElement.h>
 #include <GeoView.h>
 #include <GeometryEngine.h>
 #include <Graphic.h>
 #include <GraphicListModel.h>
 #include <GraphicsOverlay.h>
 #include <GraphicsOverlayListModel.h>
+#include <GroupLayer.h>
 #include <IdentifyLayerResult.h>
+#include <LayerListModel.h>
 #include <Map.h>
 #include <MapQuickView.h>
 #include <Multipoint.h>
 #include <Polygon.h>
 #include <Polyline.h>
+#include <QueryParameters.h>
 #include <Renderer.h>
+#include <ServiceFeatureTable.h>
 #include <SimpleFillSymbol.h>
 #include <SimpleLineSymbol.h>
 #include <SimpleMarkerSymbol.h>
@@ -59,6 +66,7 @@
 #include <UtilityNamedTraceConfiguration.h>
 #include <UtilityNetwork.h>
 #include <UtilityNetworkAttribute.h>
+#include <UtilityNetworkDefinition.h>
 #include <UtilityNetworkListModel.h>
 #include <UtilityNetworkSource.h>
 #include <UtilityNetworkTypes.h>
@@ -76,16 +84,25 @@
 #include "GeoViews.h"
 #include "UtilityNetworkFunctionTraceResult.h"
 #include "UtilityNetworkFunctionTraceResultsModel.h"
+#include "UtilityNetworkTraceHistoryModel.h"
+#include "UtilityNetworkTraceResultExporter.h"
+#include "UtilityNetworkTraceRun.h"
 #include "UtilityNetworkTraceStartingPoint.h"
 #include "UtilityNetworkTraceStartingPointsModel.h"
 
 // Qt headers
 #include <QFuture>
 #include <QList>
+#include <QPromise>
+#include <QSet>
+#include <QThreadPool>
 #include <QUuid>
 
 // std headers
+#include <algorithm>
 #include <cmath>
+#include <memory>
+#include <utility>
 
 using namespace Esri::ArcGISRuntime::Authentication;
 
@@ -151,6 +168,61 @@ namespace Esri::ArcGISRuntime::Toolkit
       QObject::connect(geoView, getGeoModelChangedSignal(geoView), self, connectToGeoModel);
       connectToGeoModel();
     }
+
+    /*!
+      \internal
+      \brief Appends every FeatureLayer in \a layers to \a featureLayers, descending into group layers.
+     */
+    void collectFeatureLayers(LayerListModel* layers, QList<FeatureLayer*>& featureLayers)
+    {
+      if (!layers)
+      {
+        return;
+      }
+
+      for (const auto layer : *layers)
+      {
+        if (auto featureLayer = dynamic_cast<FeatureLayer*>(layer))
+        {
+          featureLayers.append(featureLayer);
+        }
+        else if (auto groupLayer = dynamic_cast<GroupLayer*>(layer))
+        {
+          collectFeatureLayers(groupLayer->layers(), featureLayers);
+        }
+      }
+    }
+
+    /*!
+      \internal
+      \brief Returns whether \a featureTable is the table of one of \a networkSources.
+     */
+    bool belongsToNetworkSources(FeatureTable* featureTable, const QList<UtilityNetworkSource*>& networkSources)
+    {
+      if (!featureTable)
+      {
+        return false;
+      }
+
+      const auto serviceFeatureTable = dynamic_cast<ServiceFeatureTable*>(featureTable);
+      for (const auto networkSource : networkSources)
+      {
+        const auto sourceTable = networkSource->featureTable();
+        if (sourceTable == featureTable)
+        {
+          return true;
+        }
+
+        // layers and network sources may use distinct table objects for the same service layer
+        const auto serviceSourceTable = dynamic_cast<ServiceFeatureTable*>(sourceTable);
+        if (serviceFeatureTable && serviceSourceTable && serviceFeatureTable->uri() == serviceSourceTable->uri())
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
   } // namespace
 
   /*!
@@ -176,6 +248,8 @@ namespace Esri::ArcGISRuntime::Toolkit
     m_isAddingStartingPointInProgress(false),
     m_startingPointSymbol(new SimpleMarkerSymbol(SimpleMarkerSymbolStyle::Cross, QColor(Qt::green), 20.0f, this)),
     m_resultsGraphicsOverlay(new GraphicsOverlay(this)),
+    m_traceHistory(new UtilityNetworkTraceHistoryModel(this)),
+    m_traceRuns(new GenericListModel(&UtilityNetworkTraceRun::staticMetaObject, this)),
     m_resultPointSymbol(new SimpleMarkerSymbol(SimpleMarkerSymbolStyle::Circle, QColor(0, 0, 255, 126), 20, this)),
     m_resultLineSymbol(new SimpleLineSymbol(SimpleLineSymbolStyle::Dot, QColor(0, 0, 255, 126), 5, this)),
     m_resultFillSymbol(new SimpleFillSymbol(SimpleFillSymbolStyle::ForwardDiagonal,
@@ -243,31 +317,7 @@ namespace Esri::ArcGISRuntime::Toolkit
       {
         if (newValue)
         {
-          auto traceConfigs = m_selectedUtilityNetwork->queryNamedTraceConfigurationsAsync(nullptr).then(
-            this, [this](const QList<UtilityNamedTraceConfiguration*>& utilityNamedTraceConfigurationResults)
-          {
-            m_traceConfigurations.clear();
-            m_traceConfigurations = utilityNamedTraceConfigurationResults;
-            std::sort(std::begin(m_traceConfigurations), std::end(m_traceConfigurations), [](const auto& a, const auto& b)
-            {
-              return a->name() < b->name();
-            });
-
-            QStringList traceConfigNamesTemp{};
-
-            for (const auto& traceConfig : m_traceConfigurations)
-            {
-              traceConfigNamesTemp.append(traceConfig->name());
-            }
-
-            setTraceConfigurationNames(traceConfigNamesTemp);
-
-            if (!m_traceConfigurations.isEmpty())
-            {
-              // select the first trace configuration by default
-              m_selectedTraceConfiguration = m_traceConfigurations.at(0);
-            }
-          });
+          queryTraceConfigurations();
         }
         else
         {
@@ -287,33 +337,12 @@ namespace Esri::ArcGISRuntime::Toolkit
         }
 
         setIsAddingStartingPointEnabled(false);
-        setIsAddingStartingPointInProgress(true);
-
-        const double tolerance = 10.0;
-        const bool returnPopups = false;
-        m_mapPoint = mapView->screenToLocation(mouseEvent.pos().x(), mouseEvent.pos().y());
-
-        mapView->identifyLayersAsync(mouseEvent.position(), tolerance, returnPopups)
-          .then(this, [this](const QList<IdentifyLayerResult*>& results)
-        {
-          // handle the identify results
-          for (const auto& layer : results)
-          {
-            for (const auto& geoElement : layer->geoElements())
-            {
-              const auto ft = dynamic_cast<ArcGISFeature*>(geoElement);
-
-              if (geoElement)
-              {
-                addStartingPoint(ft, m_mapPoint);
-              }
-            }
-          }
-
-          qDeleteAll(results);
+        identifyStartingPoints(mapView, mouseEvent.position());
+      });
 
-          setIsAddingStartingPointInProgress(false);
-        });
+      connect(mapView, &MapViewToolkit::mapScaleChanged, this, [this]()
+      {
+        updateResultLevelOfDetail(false);
       });
 
       connect(this, &UtilityNetworkTraceController::selectedTraceConfigurationChanged, this, [this]()
@@ -506,244 +535,1090 @@ namespace Esri::ArcGISRuntime::Toolkit
     emit isResetResultsEnabledChanged();
   }
 
-  void UtilityNetworkTraceController::runTrace(const QString& /*name*/)
+  /*!
+    \brief Returns whether element results are still being resolved to features and selected.
+   */
+  bool UtilityNetworkTraceController::isElementSelectionInProgress() const
   {
-    if (isTraceInProgress())
+    return m_isElementSelectionInProgress;
+  }
+
+  void UtilityNetworkTraceController::setIsElementSelectionInProgress(bool isElementSelectionInProgress)
+  {
+    if (m_isElementSelectionInProgress == isElementSelectionInProgress)
     {
       return;
     }
 
-    resetTraceResults();
+    m_isElementSelectionInProgress = isElementSelectionInProgress;
+    emit isElementSelectionInProgressChanged();
+  }
 
-    setIsTraceInProgress(true);
+  /*!
+    \brief Returns the fraction, between 0 and 1, of element results which have been resolved to features and selected.
+   */
+  double UtilityNetworkTraceController::elementSelectionProgress() const
+  {
+    return m_elementSelectionProgress;
+  }
 
-    if (m_utilityTraceParameters)
+  void UtilityNetworkTraceController::setElementSelectionProgress(double elementSelectionProgress)
+  {
+    if (m_elementSelectionProgress == elementSelectionProgress)
     {
-      delete m_utilityTraceParameters;
-      m_utilityTraceParameters = nullptr;
+      return;
     }
 
-    m_utilityTraceParameters = new UtilityTraceParameters(m_selectedTraceConfiguration, m_startingPoints->utilityElements(), this);
+    m_elementSelectionProgress = elementSelectionProgress;
+    emit elementSelectionProgressChanged();
+  }
 
-    // Async UtilityNetwork::trace
-    m_selectedUtilityNetwork->traceAsync(m_utilityTraceParameters)
-      .then(this,
-            [this](const QList<UtilityTraceResult*>&)
-    {
-      onTraceCompleted();
-    })
-      .onFailed([this](const ErrorException& e)
+  /*!
+    \brief Returns the number of elements returned by the last trace.
+   */
+  int UtilityNetworkTraceController::elementResultCount() const
+  {
+    return m_elementResultCount;
+  }
+
+  void UtilityNetworkTraceController::setElementResultCount(int elementResultCount)
+  {
+    if (m_elementResultCount == elementResultCount)
     {
-      onSelectedUtilityNetworkError(e);
-    });
+      return;
+    }
+
+    m_elementResultCount = elementResultCount;
+    emit elementResultCountChanged();
   }
 
-  QList<UtilityNamedTraceConfiguration*> UtilityNetworkTraceController::traceConfigurations() const
+  /*!
+    \brief Returns \c true when the last trace returned more elements than \l maximumSelectableElements.
+
+    In this case the elements are not selected, and only \l elementResultCount and
+    \l elementResultExtent are available.
+   */
+  bool UtilityNetworkTraceController::isElementResultAboveSelectionLimit() const
   {
-    return m_traceConfigurations;
+    return m_maximumSelectableElements >= 0 && m_elementResultCount > m_maximumSelectableElements;
   }
 
-  UtilityTraceResultListModel* UtilityNetworkTraceController::traceResults()
+  /*!
+    \brief Returns the combined extent of the geometry results of the last trace.
+
+    This is empty if the trace configuration does not return geometry results.
+   */
+  Envelope UtilityNetworkTraceController::elementResultExtent() const
   {
-    return m_traceResults;
+    return m_currentTraceResult ? m_currentTraceResult->elementResultExtent : Envelope();
   }
 
-  void UtilityNetworkTraceController::refresh()
+  /*!
+    \brief Returns the number of elements resolved to features and selected per request.
+   */
+  int UtilityNetworkTraceController::elementSelectionChunkSize() const
   {
-    delete m_selectedUtilityNetwork;
-    m_selectedUtilityNetwork = nullptr;
-    delete m_selectedTraceConfiguration;
-    m_selectedTraceConfiguration = nullptr;
-    m_traceConfigurations.clear();
-    m_startingPoints->clear();
-    m_functionResults->clear();
-    m_startingPointsGraphicsOverlay->graphics()->clear();
-    m_resultsGraphicsOverlay->graphics()->clear();
-    m_isTraceInProgress = false;
-    m_isAddingStartingPointEnabled = false;
-    m_isAddingStartingPointInProgress = false;
-    m_isInsufficientStartingPoints = true;
-    m_isAboveMinimumStartingPoint = false;
-    m_isResetResultsEnabled = false;
-    emit startingPointsChanged();
+    return m_elementSelectionChunkSize;
+  }
 
-    if (m_startingPointParent)
+  void UtilityNetworkTraceController::setElementSelectionChunkSize(int elementSelectionChunkSize)
+  {
+    elementSelectionChunkSize = std::max(1, elementSelectionChunkSize);
+    if (m_elementSelectionChunkSize == elementSelectionChunkSize)
     {
-      delete m_startingPointParent;
-      m_startingPointParent = nullptr;
+      return;
     }
 
-    m_startingPointParent = new QObject(this);
-
-    setupUtilityNetworks();
+    m_elementSelectionChunkSize = elementSelectionChunkSize;
+    emit elementSelectionChunkSizeChanged();
   }
 
-  void UtilityNetworkTraceController::addStartingPoint(ArcGISFeature* identifiedFeature, const Point& mapPoint)
+  /*!
+    \brief Returns the maximum number of elements a trace may return for them to be selected on the map.
+
+    A negative value means there is no limit.
+   */
+  int UtilityNetworkTraceController::maximumSelectableElements() const
   {
-    auto geometry = identifiedFeature->geometry();
+    return m_maximumSelectableElements;
+  }
 
-    if (!m_selectedUtilityNetwork)
+  void UtilityNetworkTraceController::setMaximumSelectableElements(int maximumSelectableElements)
+  {
+    if (m_maximumSelectableElements == maximumSelectableElements)
     {
       return;
     }
 
-    auto utilityElement = m_selectedUtilityNetwork->createElementWithArcGISFeature(identifiedFeature);
+    m_maximumSelectableElements = maximumSelectableElements;
+    emit maximumSelectableElementsChanged();
+  }
 
-    if (!utilityElement)
-    {
-      // This input feature does not belong to this utility network.
-      return;
-    }
+  /*!
+    \brief Returns the approximate memory budget, in bytes, of the cache of completed trace results.
 
-    const auto startingPointAlreadyExists = m_startingPoints->doesItemAlreadyExist(utilityElement);
+    Running the same trace configuration again from the same starting points restores
+    a cached result without calling the utility network service.
+   */
+  qint64 UtilityNetworkTraceController::traceResultCacheMaximumBytes() const
+  {
+    return m_traceResultCache.maximumBytes();
+  }
 
-    // skip if starting point already exists for the selected utility element
-    if (!startingPointAlreadyExists)
+  void UtilityNetworkTraceController::setTraceResultCacheMaximumBytes(qint64 traceResultCacheMaximumBytes)
+  {
+    if (m_traceResultCache.maximumBytes() == traceResultCacheMaximumBytes)
     {
-      if (utilityElement->networkSource()->sourceType() == UtilityNetworkSourceType::Edge && geometry.geometryType() == GeometryType::Polyline)
-      {
-        auto polyline = geometry_cast<Polyline>(geometry);
-        if (polyline.hasZ())
-        {
-          // get the geometry of the identified feature as a polyline, and remove the z component
-          polyline = geometry_cast<Polyline>(GeometryEngine::removeZ(polyline));
-        }
-
-        if (mapPoint.spatialReference() != polyline.spatialReference())
-        {
-          polyline = geometry_cast<Polyline>(GeometryEngine::project(polyline, mapPoint.spatialReference()));
-        }
+      return;
+    }
 
-        geometry = polyline;
-        // compute how far the clicked location is along the edge feature
-        double fractionAlongEdge = GeometryEngine::fractionAlong(polyline, mapPoint, -1);
-        if (!std::isnan(fractionAlongEdge))
-        {
-          // set the fraction along edge
-          utilityElement->setFractionAlongEdge(fractionAlongEdge);
-        }
-      }
-      else if (utilityElement->networkSource()->sourceType() == UtilityNetworkSourceType::Junction &&
-               utilityElement->assetType()->terminalConfiguration() != nullptr)
-      {
-        auto utilityTerminalConfiguration = utilityElement->assetType()->terminalConfiguration();
-        QList<UtilityTerminal*> terminals = utilityTerminalConfiguration->terminals();
-        if (terminals.size() > 1)
-        {
-          // The user can select between multiple terminals, but by default the first one is selected
-          utilityElement->setTerminal(utilityElement->assetType()->terminalConfiguration()->terminals().at(0));
-        }
-      }
+    m_traceResultCache.setMaximumBytes(traceResultCacheMaximumBytes);
+    emit traceResultCacheMaximumBytesChanged();
+  }
 
-      auto graphic = new Graphic(geometry, m_startingPointParent);
-      graphic->attributes()->insertAttribute("GlobalId", utilityElement->globalId());
-      graphic->setSymbol(m_startingPointSymbol);
-      auto featureLayer = dynamic_cast<FeatureLayer*>(identifiedFeature->featureTable()->layer());
-      auto symbol = featureLayer->renderer()->symbol(identifiedFeature);
+  /*!
+    \brief Returns the list model of the last completed traces, newest first.
 
-      m_startingPointsGraphicsOverlay->graphics()->append(graphic);
-      if (symbol == nullptr)
-      {
-        // Adding with null symbol
-        m_startingPoints->addStartingPoint(
-          new UtilityNetworkTraceStartingPoint(utilityElement, graphic, symbol, featureLayer->fullExtent(), m_startingPointParent));
-        emit startingPointsChanged();
-      }
-      else
-      {
-        // Adding with extent
-        m_startingPoints->addStartingPoint(
-          new UtilityNetworkTraceStartingPoint(utilityElement, graphic, symbol, graphic->geometry().extent(), m_startingPointParent));
-        emit startingPointsChanged();
-      }
-    }
+    Each row has the \c name of its trace configuration, its \c startingPointCount,
+    its \c elementResultCount and the time it \c completedAt. Pass a row to
+    \l showTraceHistoryEntry to show that result again.
+   */
+  QAbstractItemModel* UtilityNetworkTraceController::traceHistory() const
+  {
+    return m_traceHistory;
   }
 
-  void UtilityNetworkTraceController::removeStartingPoint(int index)
+  /*!
+    \brief Returns the maximum number of traces kept in \l traceHistory.
+   */
+  int UtilityNetworkTraceController::maximumTraceHistoryCount() const
   {
-    m_startingPoints->removeAt(index);
-    m_startingPointsGraphicsOverlay->graphics()->removeAt(index);
-    emit startingPointsChanged();
+    return m_traceHistory->maximumCount();
   }
 
-  void UtilityNetworkTraceController::zoomToStartingPoint(int index)
+  void UtilityNetworkTraceController::setMaximumTraceHistoryCount(int maximumTraceHistoryCount)
   {
-    if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    if (m_traceHistory->maximumCount() == maximumTraceHistoryCount)
     {
-      const Viewpoint currVP = mapView->currentViewpoint(ViewpointType::CenterAndScale);
-      const Viewpoint newViewPoint(m_startingPoints->pointAt(index), currVP.targetScale());
-      auto future = mapView->setViewpointAsync(newViewPoint, 1.0);
-      Q_UNUSED(future)
+      return;
     }
+
+    m_traceHistory->setMaximumCount(maximumTraceHistoryCount);
+    emit maximumTraceHistoryCountChanged();
   }
 
-  void UtilityNetworkTraceController::removeAllStartingPoints()
+  /*!
+    \brief Returns the approximate memory, in bytes, the results in \l traceHistory may hold.
+
+    Once exceeded, the least recently shown traces are removed from the history. Defaults to 128 MB.
+   */
+  qint64 UtilityNetworkTraceController::traceHistoryMaximumBytes() const
   {
-    m_startingPointsGraphicsOverlay->graphics()->clear();
-    m_startingPoints->clear();
-    emit startingPointsChanged();
+    return m_traceHistory->maximumBytes();
   }
 
-  void UtilityNetworkTraceController::setSelectedTraceConfigurationNameByIndex(int index)
+  void UtilityNetworkTraceController::setTraceHistoryMaximumBytes(qint64 traceHistoryMaximumBytes)
   {
-    if (m_traceConfigurations.size() > index)
+    if (m_traceHistory->maximumBytes() == traceHistoryMaximumBytes)
     {
-      setSelectedTraceConfiguration(m_traceConfigurations.at(index));
+      return;
     }
+
+    m_traceHistory->setMaximumBytes(traceHistoryMaximumBytes);
+    emit traceHistoryMaximumBytesChanged();
   }
 
-  void UtilityNetworkTraceController::resetTraceResults()
-  {
-    setIsResetResultsEnabled(false);
+  /*!
+    \brief Shows the trace at \a index in \l traceHistory in place of the current results.
 
-    // Clearing GEOMETRY TRACE RESULTS
-    auto graphics = m_resultsGraphicsOverlay->graphics();
-    for (int i = 0; i < graphics->size(); ++i)
+    The geometries, function results and selected features of that trace are shown
+    straight away, the trace is not run again and no features are resolved.
+   */
+  void UtilityNetworkTraceController::showTraceHistoryEntry(int index)
+  {
+    if (isTraceInProgress())
     {
-      delete graphics->at(i);
+      return;
     }
-    m_resultsGraphicsOverlay->graphics()->clear();
-
-    // Clearing FUNCTION TRACE RESULTS
-    m_functionResults->clear();
 
-    // Clearing ELEMENT TRACE RESULTS
-    auto featuresList = m_selectedUtilityNetwork->featuresForElementsResult();
-    QHash<FeatureLayer*, QList<Feature*>> layerToFeatures;
-    for (const auto f : *featuresList)
+    const auto traceResult = m_traceHistory->traceResult(index);
+    if (!traceResult || traceResult == m_currentTraceResult)
     {
-      auto featureLayer = static_cast<FeatureLayer*>(f->featureTable()->layer());
-
-      auto findLayer = layerToFeatures.find(featureLayer);
-      if (findLayer == std::end(layerToFeatures))
-      {
-        layerToFeatures[featureLayer] = {f};
-      }
-      else
-      {
-        findLayer.value().append(f);
-      }
+      return;
     }
 
-    const auto layerKeys = layerToFeatures.keys();
-    for (const auto lyr : layerKeys)
-    {
-      lyr->unselectFeatures(layerToFeatures[lyr]);
-    }
+    resetTraceResults();
+
+    m_currentTraceResultKey = m_traceHistory->key(index);
+    m_currentTraceConfigurationName = m_traceHistory->name(index);
+    m_currentStartingPointCount = m_traceHistory->startingPointCount(index);
+    applyTraceResult(traceResult);
   }
 
-  void UtilityNetworkTraceController::onTraceCompleted()
+  /*!
+    \brief Removes every trace from \l traceHistory. The results currently shown stay on the map.
+   */
+  void UtilityNetworkTraceController::clearTraceHistory()
   {
-    m_traceResults = m_selectedUtilityNetwork->traceResult();
+    m_traceHistory->clear();
+  }
 
-    QList<UtilityElement*> allElements;
+  /*!
+    \brief Returns the list model of \c UtilityNetworkTraceRun objects started by \l runTraces.
+   */
+  QAbstractItemModel* UtilityNetworkTraceController::traceRuns() const
+  {
+    return m_traceRuns;
+  }
 
-    for (auto* result : *m_traceResults)
-    {
-      const auto type = result->traceResultObjectType();
+  /*!
+    \brief Returns whether any of the traces started by \l runTraces are still running.
+   */
+  bool UtilityNetworkTraceController::isParallelTraceInProgress() const
+  {
+    return m_isParallelTraceInProgress;
+  }
 
-      switch (type)
-      {
+  void UtilityNetworkTraceController::setIsParallelTraceInProgress(bool isParallelTraceInProgress)
+  {
+    if (m_isParallelTraceInProgress == isParallelTraceInProgress)
+    {
+      return;
+    }
+
+    m_isParallelTraceInProgress = isParallelTraceInProgress;
+    emit isParallelTraceInProgressChanged();
+  }
+
+  /*!
+    \brief Runs the trace configurations called \a names concurrently from the current starting points.
+
+    Each trace gets its own entry in \l traceRuns, with its own graphics overlay and function results,
+    so results can be compared side by side. All traces are issued at once, so the total time is close
+    to that of the slowest trace. Previous runs are cleared. \c traceRunsCompleted is emitted once
+    every trace has finished.
+   */
+  void UtilityNetworkTraceController::runTraces(const QStringList& names)
+  {
+    auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView);
+    if (isParallelTraceInProgress() || !mapView || !m_selectedUtilityNetwork)
+    {
+      return;
+    }
+
+    clearTraceRuns();
+
+    static const QList<QColor> runColors{QColor(0, 0, 255), QColor(255, 0, 0), QColor(0, 160, 0), QColor(255, 140, 0), QColor(160, 0, 200)};
+
+    const auto startingPoints = m_startingPoints->utilityElements();
+    QList<UtilityNetworkTraceRun*> runs;
+    for (const auto& name : names)
+    {
+      const auto it = std::find_if(std::cbegin(m_traceConfigurations), std::cend(m_traceConfigurations), [&name](const auto* traceConfiguration)
+      {
+        return traceConfiguration->name() == name;
+      });
+
+      if (it == std::cend(m_traceConfigurations))
+      {
+        qDebug() << "No trace configuration named" << name;
+        continue;
+      }
+
+      auto run = new UtilityNetworkTraceRun(*it, runColors.at(runs.size() % runColors.size()), m_traceRuns);
+      connect(run, &UtilityNetworkTraceRun::traceCompleted, this, [this]()
+      {
+        if (--m_pendingTraceRuns == 0)
+        {
+          setIsParallelTraceInProgress(false);
+          emit traceRunsCompleted();
+        }
+      });
+      mapView->graphicsOverlays()->append(run->graphicsOverlay());
+      runs.append(run);
+    }
+
+    if (runs.isEmpty())
+    {
+      return;
+    }
+
+    m_pendingTraceRuns = static_cast<int>(runs.size());
+    setIsParallelTraceInProgress(true);
+
+    for (auto run : std::as_const(runs))
+    {
+      m_traceRuns->append(run);
+      run->start(m_selectedUtilityNetwork, startingPoints);
+    }
+  }
+
+  /*!
+    \brief Removes all the runs started by \l runTraces and their graphics from the map.
+   */
+  void UtilityNetworkTraceController::clearTraceRuns()
+  {
+    auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView);
+    for (int i = 0; i < m_traceRuns->rowCount(); ++i)
+    {
+      auto run = m_traceRuns->element<UtilityNetworkTraceRun>(m_traceRuns->index(i));
+      if (mapView)
+      {
+        mapView->graphicsOverlays()->removeOne(run->graphicsOverlay());
+      }
+      disconnect(run, nullptr, this, nullptr);
+    }
+
+    // deletes the runs, abandoning any trace still running
+    m_traceRuns->clear();
+    m_pendingTraceRuns = 0;
+    setIsParallelTraceInProgress(false);
+  }
+
+  /*!
+    \brief Returns whether \l exportTraceResults is writing the current trace result.
+   */
+  bool UtilityNetworkTraceController::isExportInProgress() const
+  {
+    return m_exporter != nullptr;
+  }
+
+  /*!
+    \brief Returns the fraction of element results written by the running export, between 0 and 1.
+   */
+  double UtilityNetworkTraceController::exportProgress() const
+  {
+    return m_exportProgress;
+  }
+
+  void UtilityNetworkTraceController::setExportProgress(double exportProgress)
+  {
+    if (m_exportProgress == exportProgress)
+    {
+      return;
+    }
+
+    m_exportProgress = exportProgress;
+    emit exportProgressChanged();
+  }
+
+  /*!
+    \brief Writes the current trace result to the file at \a fileUrl.
+
+    A file with a \c .csv suffix is written as CSV, with a row per element, function output
+    and geometry result, the latter carrying its geometry as GeoJSON in WGS84. Any other file is
+    written as a GeoJSON feature collection in WGS84, in which each element carries the geometry
+    and layer name of its feature.
+
+    The file is written incrementally, element results in chunks of \l elementSelectionChunkSize,
+    so the UI stays responsive during large exports. \c exportCompleted is emitted once done.
+    Returns \c false if there is no trace result, an export is already running, or the
+    file could not be opened.
+   */
+  bool UtilityNetworkTraceController::exportTraceResults(const QUrl& fileUrl)
+  {
+    if (m_exporter || !m_currentTraceResult)
+    {
+      return false;
+    }
+
+    const auto filePath = fileUrl.isLocalFile() ? fileUrl.toLocalFile() : fileUrl.toString();
+    const auto format = filePath.endsWith(QStringLiteral(".csv"), Qt::CaseInsensitive) ? UtilityNetworkTraceResultExporter::Format::Csv
+                                                                                        : UtilityNetworkTraceResultExporter::Format::GeoJson;
+
+    // the exporter shares the result, so it stays valid even if the trace is reset while exporting
+    auto exporter = new UtilityNetworkTraceResultExporter(m_selectedUtilityNetwork, m_currentTraceResult, this);
+    connect(exporter, &UtilityNetworkTraceResultExporter::progressChanged, this, &UtilityNetworkTraceController::setExportProgress);
+    connect(exporter, &UtilityNetworkTraceResultExporter::finished, this, [this, exporter](bool success, const QString& errorMessage)
+    {
+      exporter->deleteLater();
+      m_exporter = nullptr;
+      emit isExportInProgressChanged();
+      emit exportCompleted(success, errorMessage);
+    });
+
+    setExportProgress(0.0);
+    if (!exporter->start(filePath, format, m_elementSelectionChunkSize))
+    {
+      qDebug() << "Could not export trace results to" << filePath << exporter->errorMessage();
+      delete exporter;
+      return false;
+    }
+
+    m_exporter = exporter;
+    emit isExportInProgressChanged();
+    return true;
+  }
+
+  /*!
+    \brief Stops the running export and removes its partially written file.
+   */
+  void UtilityNetworkTraceController::cancelExport()
+  {
+    if (m_exporter)
+    {
+      m_exporter->cancel();
+    }
+  }
+
+  /*!
+    \brief Returns whether a click adds at most one starting point.
+
+    When \c true, identifying stops at the first feature of the utility network found under the click.
+   */
+  bool UtilityNetworkTraceController::isSingleStartingPointPickEnabled() const
+  {
+    return m_isSingleStartingPointPickEnabled;
+  }
+
+  void UtilityNetworkTraceController::setIsSingleStartingPointPickEnabled(bool isSingleStartingPointPickEnabled)
+  {
+    if (m_isSingleStartingPointPickEnabled == isSingleStartingPointPickEnabled)
+    {
+      return;
+    }
+
+    m_isSingleStartingPointPickEnabled = isSingleStartingPointPickEnabled;
+    emit isSingleStartingPointPickEnabledChanged();
+  }
+
+  void UtilityNetworkTraceController::runTrace(const QString& /*name*/)
+  {
+    // a configuration listed from the cache cannot be traced until the query for it has completed
+    if (isTraceInProgress() || !m_selectedTraceConfiguration)
+    {
+      return;
+    }
+
+    // also cancels any element selection still in progress from the previous trace
+    resetTraceResults();
+
+    m_currentTraceResultKey = UtilityNetworkTraceResultCache::key(m_selectedUtilityNetwork, m_selectedTraceConfiguration,
+                                                                  m_startingPoints->utilityElements());
+    m_currentTraceConfigurationName = m_selectedTraceConfiguration->name();
+    m_currentStartingPointCount = m_startingPoints->size();
+    if (const auto cachedResult = m_traceResultCache.find(m_currentTraceResultKey))
+    {
+      // this exact trace has already run, so there is no need to call the service again
+      applyTraceResult(cachedResult);
+      m_traceHistory->add(m_currentTraceResultKey, m_currentTraceConfigurationName, m_currentStartingPointCount, cachedResult);
+      return;
+    }
+
+    setIsTraceInProgress(true);
+
+    if (m_utilityTraceParameters)
+    {
+      delete m_utilityTraceParameters;
+      m_utilityTraceParameters = nullptr;
+    }
+
+    m_utilityTraceParameters = new UtilityTraceParameters(m_selectedTraceConfiguration, m_startingPoints->utilityElements(), this);
+
+    // Async UtilityNetwork::trace
+    const auto traceGeneration = m_traceGeneration;
+    m_selectedUtilityNetwork->traceAsync(m_utilityTraceParameters, this)
+      .then(this,
+            [this, traceGeneration](const QList<UtilityTraceResult*>& results)
+    {
+      if (traceGeneration != m_traceGeneration)
+      {
+        // results were reset while the trace was running
+        qDeleteAll(results);
+        setIsTraceInProgress(false);
+        return;
+      }
+      onTraceCompleted(results);
+    })
+      .onFailed([this](const ErrorException& e)
+    {
+      onSelectedUtilityNetworkError(e);
+    });
+  }
+
+  QList<UtilityNamedTraceConfiguration*> UtilityNetworkTraceController::traceConfigurations() const
+  {
+    return m_traceConfigurations;
+  }
+
+  /*!
+    \brief Returns the utility network's results of the trace currently shown.
+
+    Returns \c nullptr while the results shown were restored from the result cache or the trace history,
+    as the network's model holds the results of whichever trace it last ran. Their function results
+    are in \l functionResults.
+   */
+  UtilityTraceResultListModel* UtilityNetworkTraceController::traceResults()
+  {
+    return m_traceResults;
+  }
+
+  void UtilityNetworkTraceController::refresh()
+  {
+    // the export resolves features through the utility network deleted below
+    cancelExport();
+    clearTraceRuns();
+    cancelElementSelection();
+    m_currentTraceResult.reset();
+    m_currentTraceResultKey.clear();
+    m_traceResultCache.clear();
+    m_traceHistory->clear();
+    setElementResultCount(0);
+
+    delete m_selectedUtilityNetwork;
+    m_selectedUtilityNetwork = nullptr;
+    delete m_selectedTraceConfiguration;
+    m_selectedTraceConfiguration = nullptr;
+    m_traceConfigurations.clear();
+    m_cachedTraceConfigurations.clear();
+    m_pendingTraceConfigurationName.clear();
+    m_startingPoints->clear();
+    m_functionResults->clear();
+    m_startingPointsGraphicsOverlay->graphics()->clear();
+    m_resultsGraphicsOverlay->graphics()->clear();
+    m_isTraceInProgress = false;
+    m_isAddingStartingPointEnabled = false;
+    m_isAddingStartingPointInProgress = false;
+    ++m_startingPointGeneration;
+    m_isInsufficientStartingPoints = true;
+    m_isAboveMinimumStartingPoint = false;
+    m_isResetResultsEnabled = false;
+    emit startingPointsChanged();
+
+    if (m_startingPointParent)
+    {
+      delete m_startingPointParent;
+      m_startingPointParent = nullptr;
+    }
+
+    m_startingPointParent = new QObject(this);
+
+    setupUtilityNetworks();
+  }
+
+  void UtilityNetworkTraceController::addStartingPoint(ArcGISFeature* identifiedFeature, const Point& mapPoint)
+  {
+    QSet<QString> addedElementKeys;
+    auto startingPoint = createStartingPoint(identifiedFeature, mapPoint, addedElementKeys);
+    if (!startingPoint)
+    {
+      return;
+    }
+
+    m_startingPointsGraphicsOverlay->graphics()->append(startingPoint->selectionGraphic());
+    m_startingPoints->addStartingPoint(startingPoint);
+    emit startingPointsChanged();
+  }
+
+  /*!
+    \brief Adds a starting point for each of \a features which belongs to the selected utility network.
+
+    Features which are already starting points are skipped. Edge starting points are placed
+    halfway along the edge. All graphics and model rows are inserted in a single batch.
+   */
+  void UtilityNetworkTraceController::addStartingPoints(const QList<ArcGISFeature*>& features)
+  {
+    QSet<QString> addedElementKeys;
+    QList<UtilityNetworkTraceStartingPoint*> startingPoints;
+    QList<Graphic*> graphics;
+
+    for (const auto feature : features)
+    {
+      if (auto startingPoint = createStartingPoint(feature, Point(), addedElementKeys))
+      {
+        startingPoints.append(startingPoint);
+        graphics.append(startingPoint->selectionGraphic());
+      }
+    }
+
+    if (startingPoints.isEmpty())
+    {
+      return;
+    }
+
+    m_startingPointsGraphicsOverlay->graphics()->append(graphics);
+    m_startingPoints->addStartingPoints(startingPoints);
+    emit startingPointsChanged();
+  }
+
+  /*!
+    \brief Adds a starting point for each feature in \a queryResults which belongs to the selected utility network.
+
+    The features of all results are added in a single batch. They are only needed to create the
+    utility elements and are deleted afterwards.
+   */
+  void UtilityNetworkTraceController::addStartingPoints(const QList<FeatureQueryResult*>& queryResults)
+  {
+    QObject featuresParent;
+    QList<ArcGISFeature*> arcGISFeatures;
+    for (const auto queryResult : queryResults)
+    {
+      if (!queryResult)
+      {
+        continue;
+      }
+
+      const auto features = queryResult->iterator().features(&featuresParent);
+      for (const auto feature : features)
+      {
+        if (auto arcGISFeature = dynamic_cast<ArcGISFeature*>(feature))
+        {
+          arcGISFeatures.append(arcGISFeature);
+        }
+      }
+    }
+
+    addStartingPoints(arcGISFeatures);
+  }
+
+  /*!
+    \brief Adds a starting point for every feature of the selected utility network which intersects \a geometry.
+
+    For example, every valve inside a drawn polygon. Each utility network layer is queried
+    concurrently, and \l isAddingStartingPointInProgress is \c true until all queries completed.
+    The starting points are then added in a single batch, unless the utility network has been
+    refreshed or the starting points removed meanwhile.
+   */
+  void UtilityNetworkTraceController::addStartingPoints(const Geometry& geometry)
+  {
+    if (geometry.isEmpty() || !m_selectedUtilityNetwork || isAddingStartingPointInProgress())
+    {
+      return;
+    }
+
+    QueryParameters parameters;
+    parameters.setGeometry(geometry);
+    parameters.setSpatialRelationship(SpatialRelationship::Intersects);
+    parameters.setReturnGeometry(true);
+
+    const auto featureLayers = utilityNetworkFeatureLayers();
+    if (featureLayers.isEmpty())
+    {
+      return;
+    }
+
+    setIsAddingStartingPointInProgress(true);
+    const auto startingPointGeneration = ++m_startingPointGeneration;
+    auto pendingQueries = std::make_shared<int>(static_cast<int>(featureLayers.size()));
+    auto queryResults = std::make_shared<QList<FeatureQueryResult*>>();
+
+    for (const auto featureLayer : featureLayers)
+    {
+      auto featureTable = featureLayer->featureTable();
+
+      // utility elements need the asset group and asset type fields, which are not loaded by default
+      auto serviceFeatureTable = dynamic_cast<ServiceFeatureTable*>(featureTable);
+      auto future = serviceFeatureTable ? serviceFeatureTable->queryFeaturesAsync(parameters, QueryFeatureFields::LoadAll, this)
+                                        : featureTable->queryFeaturesAsync(parameters, this);
+
+      future
+        .then(this,
+              [queryResults](FeatureQueryResult* queryResult)
+      {
+        queryResults->append(queryResult);
+      })
+        .onFailed(this, [](const ErrorException& e)
+      {
+        qDebug() << "Starting point query failed" << e.error().message() << "||" << e.error().additionalMessage();
+      })
+        .then(this, [this, startingPointGeneration, pendingQueries, queryResults]()
+      {
+        if (--(*pendingQueries) != 0)
+        {
+          return;
+        }
+
+        const auto results = std::exchange(*queryResults, {});
+        if (startingPointGeneration == m_startingPointGeneration)
+        {
+          addStartingPoints(results);
+          setIsAddingStartingPointInProgress(false);
+        }
+        qDeleteAll(results);
+      });
+    }
+  }
+
+  UtilityNetworkTraceStartingPoint* UtilityNetworkTraceController::createStartingPoint(ArcGISFeature* feature,
+                                                                                       const Point& mapPoint,
+                                                                                       QSet<QString>& addedElementKeys)
+  {
+    if (!m_selectedUtilityNetwork || !feature)
+    {
+      return nullptr;
+    }
+
+    auto geometry = feature->geometry();
+    auto utilityElement = m_selectedUtilityNetwork->createElementWithArcGISFeature(feature, nullptr, m_startingPointParent);
+
+    if (!utilityElement)
+    {
+      // This input feature does not belong to this utility network.
+      return nullptr;
+    }
+
+    if (utilityElement->networkSource()->sourceType() == UtilityNetworkSourceType::Junction &&
+        utilityElement->assetType()->terminalConfiguration() != nullptr)
+    {
+      const auto terminals = utilityElement->assetType()->terminalConfiguration()->terminals();
+      if (terminals.size() > 1)
+      {
+        // The user can select between multiple terminals, but by default the first one is selected
+        utilityElement->setTerminal(terminals.at(0));
+      }
+    }
+
+    // skip if starting point already exists for the selected utility element
+    const auto elementKey = UtilityNetworkTraceStartingPointsModel::elementKey(utilityElement);
+    if (m_startingPoints->doesItemAlreadyExist(utilityElement) || addedElementKeys.contains(elementKey))
+    {
+      delete utilityElement;
+      return nullptr;
+    }
+    addedElementKeys.insert(elementKey);
+
+    if (utilityElement->networkSource()->sourceType() == UtilityNetworkSourceType::Edge && geometry.geometryType() == GeometryType::Polyline)
+    {
+      auto polyline = geometry_cast<Polyline>(geometry);
+      if (polyline.hasZ())
+      {
+        // get the geometry of the identified feature as a polyline, and remove the z component
+        polyline = geometry_cast<Polyline>(GeometryEngine::removeZ(polyline));
+      }
+
+      if (mapPoint.isEmpty())
+      {
+        // no location was picked on the edge, so start halfway along it
+        utilityElement->setFractionAlongEdge(0.5);
+      }
+      else
+      {
+        if (mapPoint.spatialReference() != polyline.spatialReference())
+        {
+          polyline = geometry_cast<Polyline>(GeometryEngine::project(polyline, mapPoint.spatialReference()));
+        }
+
+        // compute how far the clicked location is along the edge feature
+        double fractionAlongEdge = GeometryEngine::fractionAlong(polyline, mapPoint, -1);
+        if (!std::isnan(fractionAlongEdge))
+        {
+          // set the fraction along edge
+          utilityElement->setFractionAlongEdge(fractionAlongEdge);
+        }
+      }
+
+      geometry = polyline;
+    }
+
+    auto graphic = new Graphic(geometry, m_startingPointParent);
+    graphic->attributes()->insertAttribute("GlobalId", utilityElement->globalId());
+    graphic->setSymbol(m_startingPointSymbol);
+    auto* featureTable = feature->featureTable();
+    auto featureLayer = featureTable ? dynamic_cast<FeatureLayer*>(featureTable->layer()) : nullptr;
+    auto* renderer = featureLayer ? featureLayer->renderer() : nullptr;
+    // features added in bulk may come from a table without a feature layer or renderer
+    auto symbol = renderer ? renderer->symbol(feature) : m_startingPointSymbol;
+
+    if (symbol == nullptr && featureLayer)
+    {
+      // Adding with null symbol
+      return new UtilityNetworkTraceStartingPoint(utilityElement, graphic, symbol, featureLayer->fullExtent(), m_startingPointParent);
+    }
+
+    // Adding with extent
+    return new UtilityNetworkTraceStartingPoint(utilityElement, graphic, symbol, graphic->geometry().extent(), m_startingPointParent);
+  }
+
+  /*!
+    \internal
+    \brief Identifies starting points at \a screenPoint.
+
+    Only the visible layers of the selected utility network are identified, one request per layer,
+    all issued at once. In single pick mode, the eligible feature of the topmost layer becomes the
+    starting point as soon as that layer and every layer above it have been identified, regardless of
+    which request completed first, and the requests of the layers below it are cancelled.
+   */
+  void UtilityNetworkTraceController::identifyStartingPoints(MapViewToolkit* mapView, const QPointF& screenPoint)
+  {
+    auto featureLayers = utilityNetworkFeatureLayers();
+    featureLayers.erase(std::remove_if(std::begin(featureLayers), std::end(featureLayers), [](FeatureLayer* featureLayer)
+    {
+      return !featureLayer->isVisible();
+    }),
+                        std::end(featureLayers));
+
+    if (featureLayers.isEmpty())
+    {
+      qDebug() << "No visible layer belongs to a network source of the selected utility network, no starting point was identified";
+      return;
+    }
+
+    setIsAddingStartingPointInProgress(true);
+
+    const double tolerance = 10.0;
+    const bool returnPopups = false;
+    m_mapPoint = mapView->screenToLocation(screenPoint.x(), screenPoint.y());
+
+    // the state of a single pick, each list in featureLayers order
+    struct SinglePick
+    {
+      QList<QFuture<IdentifyLayerResult*>> futures;
+      QList<IdentifyLayerResult*> results;
+      QList<bool> isIdentified;
+      // layers are listed in drawing order, so the topmost one is last and picked from first
+      qsizetype nextLayer = -1;
+      bool isDone = false;
+    };
+
+    // continuations from an earlier click must not add to this one
+    const auto startingPointGeneration = ++m_startingPointGeneration;
+    const bool isSinglePick = m_isSingleStartingPointPickEnabled;
+    auto pendingIdentifies = std::make_shared<int>(static_cast<int>(featureLayers.size()));
+    auto singlePick = std::make_shared<SinglePick>();
+    singlePick->results.resize(featureLayers.size(), nullptr);
+    singlePick->isIdentified.resize(featureLayers.size(), false);
+    singlePick->nextLayer = featureLayers.size() - 1;
+
+    for (qsizetype i = 0; i < featureLayers.size(); ++i)
+    {
+      const auto featureLayer = featureLayers.at(i);
+      auto future = isSinglePick ? mapView->identifyLayerAsync(featureLayer, screenPoint, tolerance, returnPopups, 1, this)
+                                 : mapView->identifyLayerAsync(featureLayer, screenPoint, tolerance, returnPopups, this);
+      if (isSinglePick)
+      {
+        singlePick->futures.append(future);
+      }
+
+      future
+        .then(this,
+              [this, startingPointGeneration, isSinglePick, singlePick, i](IdentifyLayerResult* result)
+      {
+        if (startingPointGeneration != m_startingPointGeneration || !isAddingStartingPointInProgress() || singlePick->isDone)
+        {
+          delete result;
+          return;
+        }
+
+        if (isSinglePick)
+        {
+          singlePick->results[i] = result;
+          return;
+        }
+
+        for (const auto& geoElement : result->geoElements())
+        {
+          if (const auto feature = dynamic_cast<ArcGISFeature*>(geoElement))
+          {
+            addStartingPoint(feature, m_mapPoint);
+          }
+        }
+
+        delete result;
+      })
+        .onFailed(this, [](const ErrorException& e)
+      {
+        qDebug() << "Starting point identify failed" << e.error().message() << "||" << e.error().additionalMessage();
+      })
+        .then(this, [this, startingPointGeneration, isSinglePick, pendingIdentifies, singlePick, i]()
+      {
+        const bool isCurrent = startingPointGeneration == m_startingPointGeneration && isAddingStartingPointInProgress();
+        if (isSinglePick && isCurrent && !singlePick->isDone)
+        {
+          singlePick->isIdentified[i] = true;
+
+          bool isPicked = false;
+          while (!isPicked && singlePick->nextLayer >= 0 && singlePick->isIdentified.at(singlePick->nextLayer))
+          {
+            const auto* result = singlePick->results.at(singlePick->nextLayer--);
+            isPicked = result && addFirstStartingPoint(result->geoElements());
+          }
+
+          // otherwise a layer above any hit has not been identified yet
+          if (isPicked || singlePick->nextLayer < 0)
+          {
+            singlePick->isDone = true;
+            for (auto& pendingFuture : singlePick->futures)
+            {
+              pendingFuture.cancel();
+            }
+            qDeleteAll(std::exchange(singlePick->results, {}));
+            setIsAddingStartingPointInProgress(false);
+          }
+        }
+        else if (isSinglePick && !singlePick->isDone)
+        {
+          // superseded by a later click
+          singlePick->isDone = true;
+          qDeleteAll(std::exchange(singlePick->results, {}));
+        }
+
+        if (--(*pendingIdentifies) == 0 && isCurrent && !singlePick->isDone)
+        {
+          setIsAddingStartingPointInProgress(false);
+        }
+      });
+    }
+  }
+
+  /*!
+    \internal
+    \brief Adds the first of \a geoElements which becomes a starting point, returns \c false if none did.
+   */
+  bool UtilityNetworkTraceController::addFirstStartingPoint(const QList<GeoElement*>& geoElements)
+  {
+    for (const auto& geoElement : geoElements)
+    {
+      const auto feature = dynamic_cast<ArcGISFeature*>(geoElement);
+      if (!feature)
+      {
+        continue;
+      }
+
+      const auto startingPointCount = m_startingPoints->size();
+      addStartingPoint(feature, m_mapPoint);
+      if (m_startingPoints->size() > startingPointCount)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  QList<FeatureLayer*> UtilityNetworkTraceController::utilityNetworkFeatureLayers() const
+  {
+    QList<FeatureLayer*> featureLayers;
+
+    const auto mapView = qobject_cast<MapViewToolkit*>(m_geoView);
+    if (!mapView || !mapView->map() || !m_selectedUtilityNetwork || !m_selectedUtilityNetwork->definition())
+    {
+      return featureLayers;
+    }
+
+    const auto networkSources = m_selectedUtilityNetwork->definition()->networkSources();
+    collectFeatureLayers(mapView->map()->operationalLayers(), featureLayers);
+
+    featureLayers.erase(std::remove_if(std::begin(featureLayers), std::end(featureLayers), [&networkSources](FeatureLayer* featureLayer)
+    {
+      return !belongsToNetworkSources(featureLayer->featureTable(), networkSources);
+    }),
+                        std::end(featureLayers));
+
+    return featureLayers;
+  }
+
+  void UtilityNetworkTraceController::removeStartingPoint(int index)
+  {
+    m_startingPoints->removeAt(index);
+    m_startingPointsGraphicsOverlay->graphics()->removeAt(index);
+    emit startingPointsChanged();
+  }
+
+  void UtilityNetworkTraceController::zoomToStartingPoint(int index)
+  {
+    if (auto* mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    {
+      const Viewpoint currVP = mapView->currentViewpoint(ViewpointType::CenterAndScale);
+      const Viewpoint newViewPoint(m_startingPoints->pointAt(index), currVP.targetScale());
+      auto future = mapView->setViewpointAsync(newViewPoint, 1.0);
+      Q_UNUSED(future)
+    }
+  }
+
+  void UtilityNetworkTraceController::removeAllStartingPoints()
+  {
+    // identify and query results still to come must not add to the cleared starting points
+    ++m_startingPointGeneration;
+    setIsAddingStartingPointInProgress(false);
+    m_startingPointsGraphicsOverlay->graphics()->clear();
+    m_startingPoints->clear();
+    emit startingPointsChanged();
+  }
+
+  void UtilityNetworkTraceController::setSelectedTraceConfigurationNameByIndex(int index)
+  {
+    if (m_traceConfigurations.size() > index)
+    {
+      setSelectedTraceConfiguration(m_traceConfigurations.at(index));
+    }
+    else if (m_traceConfigurations.isEmpty() && index >= 0 && m_cachedTraceConfigurations.size() > index)
+    {
+      // the configuration itself is selected once the query completes
+      m_pendingTraceConfigurationName = m_cachedTraceConfigurations.at(index).name;
+      applyStartingPointWarnings();
+    }
+  }
+
+  void UtilityNetworkTraceController::resetTraceResults()
+  {
+    setIsResetResultsEnabled(false);
+    // set again only by a trace which is run against the network
+    m_traceResults = nullptr;
+
+    // Clearing GEOMETRY TRACE RESULTS
+    auto graphics = m_resultsGraphicsOverlay->graphics();
+    for (int i = 0; i < graphics->size(); ++i)
+    {
+      delete graphics->at(i);
+    }
+    m_resultsGraphicsOverlay->graphics()->clear();
+    m_resultGraphics.clear();
+    m_resultLevelOfDetail = -1;
+
+    // Clearing FUNCTION TRACE RESULTS
+    m_functionResults->clear();
+
+    // Clearing ELEMENT TRACE RESULTS
+    cancelElementSelection();
+
+    if (m_currentTraceResult)
+    {
+      // features were grouped by layer as they were selected, so no need to group them again here
+      const auto& selectedFeatures = m_currentTraceResult->selectedFeatures;
+      for (auto it = selectedFeatures.cbegin(); it != selectedFeatures.cend(); ++it)
+      {
+        it.key()->unselectFeatures(it.value());
+      }
+    }
+
+    // the features are only deleted here if the result was not cached
+    m_currentTraceResult.reset();
+    m_currentTraceResultKey.clear();
+
+    setElementResultCount(0);
+  }
+
+  /*!
+    \brief Stops resolving and selecting the element results of the current trace.
+
+    Features which have already been selected stay selected until \l resetTraceResults is called.
+   */
+  void UtilityNetworkTraceController::cancelElementSelection()
+  {
+    ++m_traceGeneration;
+    m_pendingElements.clear();
+    m_nextElementIndex = 0;
+    m_resolvedElementCount = 0;
+    setIsElementSelectionInProgress(false);
+    setElementSelectionProgress(0.0);
+  }
+
+  void UtilityNetworkTraceController::onTraceCompleted(const QList<UtilityTraceResult*>& results)
+  {
+    m_traceResults = m_selectedUtilityNetwork->traceResult();
+    m_currentTraceResult = std::make_shared<UtilityNetworkTraceResultCache::Entry>();
+
+    QList<UtilityElement*> allElements;
+
+    for (auto* result : results)
+    {
+      // the trace result keeps its elements alive for as long as the cached result exists
+      result->setParent(m_currentTraceResult->resultsParent);
+
+      const auto type = result->traceResultObjectType();
+
+      switch (type)
+      {
         case UtilityTraceResultObjectType::UtilityElementTraceResult:
         {
           // Trace completed with Element Result
@@ -762,8 +1637,10 @@ namespace Esri::ArcGISRuntime::Toolkit
           for (const auto o : outputList)
           {
             const auto function = o->function();
-            m_functionResults->addFunctionResult(UtilityNetworkFunctionTraceResult(function->functionName(), function->networkAttribute()->name(),
-                                                                                   function->functionType(), o->result().toDouble()));
+            const UtilityNetworkFunctionTraceResult result(function->functionName(), function->networkAttribute()->name(),
+                                                           function->functionType(), o->result().toDouble());
+            m_currentTraceResult->functionResults.append(result);
+            m_functionResults->addFunctionResult(result);
           }
 
           break;
@@ -774,28 +1651,14 @@ namespace Esri::ArcGISRuntime::Toolkit
           setIsResetResultsEnabled(true);
           auto geometryTraceResult = static_cast<UtilityGeometryTraceResult*>(result);
 
-          auto multipoint = geometryTraceResult->multipoint();
-          if (!multipoint.isEmpty())
-          {
-            // will be deleted in resetTraceResults()
-            auto graphic = new Graphic(multipoint, m_resultPointSymbol, this);
-            m_resultsGraphicsOverlay->graphics()->append(graphic);
-          }
-
-          auto polyline = geometryTraceResult->polyline();
-          if (!polyline.isEmpty())
+          const QList<Geometry> geometries{geometryTraceResult->multipoint(), geometryTraceResult->polyline(), geometryTraceResult->polygon()};
+          for (const auto& geometry : geometries)
           {
-            // will be deleted in resetTraceResults()
-            auto graphic = new Graphic(polyline, m_resultLineSymbol, this);
-            m_resultsGraphicsOverlay->graphics()->append(graphic);
-          }
-
-          auto polygon = geometryTraceResult->polygon();
-          if (!polygon.isEmpty())
-          {
-            // will be deleted in resetTraceResults()
-            auto graphic = new Graphic(polygon, m_resultFillSymbol, this);
-            m_resultsGraphicsOverlay->graphics()->append(graphic);
+            if (!geometry.isEmpty())
+            {
+              m_currentTraceResult->geometries.append(geometry);
+              addResultGraphic(geometry);
+            }
           }
 
           break;
@@ -808,25 +1671,68 @@ namespace Esri::ArcGISRuntime::Toolkit
       }
     }
 
-    if (!allElements.isEmpty())
+    if (!m_currentTraceResult->geometries.isEmpty())
     {
-      // calling async featuresForElements with elements
-      m_selectedUtilityNetwork->featuresForElementsAsync(allElements)
-        .then(this,
-              [this](const QList<ArcGISFeature*>&)
-      {
-        onFeaturesForElementsCompleted();
-      })
-        .onFailed([this](const ErrorException& e)
-      {
-        onSelectedUtilityNetworkError(e);
-      });
+      m_currentTraceResult->elementResultExtent = GeometryEngine::combineExtents(m_currentTraceResult->geometries);
     }
-    else
+
+    m_currentTraceResult->elements = allElements;
+    m_currentTraceResult->elementResultCount = static_cast<int>(allElements.size());
+    setElementResultCount(m_currentTraceResult->elementResultCount);
+    setIsTraceInProgress(false);
+    generalizeResultGeometries();
+
+    if (allElements.isEmpty() || isElementResultAboveSelectionLimit())
+    {
+      // Selecting this many features would stall the UI. Only the count and extent are reported.
+      cacheCurrentTraceResult();
+      return;
+    }
+
+    // Resolve the elements to features and select them in bounded chunks. A new trace or a
+    // reset increments m_traceGeneration which makes any outstanding chunk bail out.
+    m_pendingElements = allElements;
+    m_nextElementIndex = 0;
+    m_resolvedElementCount = 0;
+    setElementSelectionProgress(0.0);
+    setIsElementSelectionInProgress(true);
+    selectNextElementChunk(m_traceGeneration);
+  }
+
+  void UtilityNetworkTraceController::selectNextElementChunk(quint64 traceGeneration)
+  {
+    if (traceGeneration != m_traceGeneration || !m_selectedUtilityNetwork)
+    {
+      return;
+    }
+
+    if (m_nextElementIndex >= m_pendingElements.size())
     {
-      // when the above async completes, the run trace in-progress will be set to false
-      setIsTraceInProgress(false);
+      m_pendingElements.clear();
+      setElementSelectionProgress(1.0);
+      setIsElementSelectionInProgress(false);
+      cacheCurrentTraceResult();
+      return;
     }
+
+    const auto chunk = m_pendingElements.mid(m_nextElementIndex, m_elementSelectionChunkSize);
+    m_nextElementIndex += chunk.size();
+
+    m_selectedUtilityNetwork->featuresForElementsAsync(chunk, this)
+      .then(this,
+            [this, traceGeneration](const QList<ArcGISFeature*>& features)
+    {
+      onFeaturesForElementsCompleted(traceGeneration, features);
+    })
+      .onFailed(this, [this, traceGeneration](const ErrorException& e)
+    {
+      if (traceGeneration != m_traceGeneration)
+      {
+        return;
+      }
+      cancelElementSelection();
+      onSelectedUtilityNetworkError(e);
+    });
   }
 
   void UtilityNetworkTraceController::onSelectedUtilityNetworkError(const ErrorException& e)
@@ -835,32 +1741,280 @@ namespace Esri::ArcGISRuntime::Toolkit
     setIsTraceInProgress(false);
   }
 
-  void UtilityNetworkTraceController::onFeaturesForElementsCompleted()
+  void UtilityNetworkTraceController::onFeaturesForElementsCompleted(quint64 traceGeneration, const QList<ArcGISFeature*>& features)
   {
-    auto featuresList = m_selectedUtilityNetwork->featuresForElementsResult();
+    if (traceGeneration != m_traceGeneration)
+    {
+      // superseded by a newer trace or a reset
+      qDeleteAll(features);
+      return;
+    }
+
     QHash<FeatureLayer*, QList<Feature*>> layerToFeatures;
-    for (const auto f : *featuresList)
+    for (const auto f : features)
     {
+      f->setParent(m_currentTraceResult->resultsParent);
       auto featureLayer = static_cast<FeatureLayer*>(f->featureTable()->layer());
+      layerToFeatures[featureLayer].append(f);
+    }
+
+    for (auto it = layerToFeatures.cbegin(); it != layerToFeatures.cend(); ++it)
+    {
+      it.key()->selectFeatures(it.value());
+      m_currentTraceResult->selectedFeatures[it.key()].append(it.value());
+    }
+
+    m_resolvedElementCount = m_nextElementIndex;
+    setElementSelectionProgress(static_cast<double>(m_resolvedElementCount) / static_cast<double>(m_pendingElements.size()));
+
+    selectNextElementChunk(traceGeneration);
+  }
+
+  void UtilityNetworkTraceController::addResultGraphic(const Geometry& geometry)
+  {
+    Symbol* symbol = nullptr;
+    switch (geometry.geometryType())
+    {
+      case GeometryType::Multipoint:
+        symbol = m_resultPointSymbol;
+        break;
+      case GeometryType::Polyline:
+        symbol = m_resultLineSymbol;
+        break;
+      case GeometryType::Polygon:
+        symbol = m_resultFillSymbol;
+        break;
+      default:
+        return;
+    }
+
+    // will be deleted in resetTraceResults()
+    auto graphic = new Graphic(geometry, symbol, this);
+    m_resultsGraphicsOverlay->graphics()->append(graphic);
+    m_resultGraphics.append(graphic);
+  }
+
+  /*!
+    \internal
+    \brief Generalizes the current result geometries for each scale band on a worker thread.
+
+    Generalized geometries are stored with the trace result, so a cached result is only generalized once.
+   */
+  void UtilityNetworkTraceController::generalizeResultGeometries()
+  {
+    if (!m_isResultGeneralizationEnabled || !m_currentTraceResult)
+    {
+      return;
+    }
+
+    auto traceResult = m_currentTraceResult;
+    if (hasCurrentGeneralizations(*traceResult))
+    {
+      updateResultLevelOfDetail(true);
+      return;
+    }
 
-      auto findLayer = layerToFeatures.find(featureLayer);
-      if (findLayer == std::end(layerToFeatures))
+    auto promise = std::make_shared<QPromise<QList<QList<Geometry>>>>();
+    auto future = promise->future();
+
+    QThreadPool::globalInstance()->start([promise, geometries = traceResult->geometries, scales = m_generalizationScales]()
+    {
+      promise->start();
+
+      QList<QList<Geometry>> generalizedGeometries;
+      generalizedGeometries.reserve(geometries.size());
+      for (const auto& geometry : geometries)
       {
-        layerToFeatures[featureLayer] = {f};
+        QList<Geometry> levels;
+        // multipoints can not be generalized
+        if (geometry.geometryType() == GeometryType::Polyline || geometry.geometryType() == GeometryType::Polygon)
+        {
+          for (const auto scale : scales)
+          {
+            // allow a deviation of one 96 DPI pixel at this scale
+            double maxDeviation = scale * 0.0254 / 96.0;
+            if (geometry.spatialReference().isGeographic())
+            {
+              maxDeviation /= 111320.0; // approximate meters per degree
+            }
+            levels.append(GeometryEngine::generalize(geometry, maxDeviation, true));
+          }
+        }
+        generalizedGeometries.append(levels);
       }
-      else
+
+      promise->addResult(generalizedGeometries);
+      promise->finish();
+    });
+
+    future.then(this, [this, traceResult, key = m_currentTraceResultKey, scales = m_generalizationScales](const QList<QList<Geometry>>& generalizedGeometries)
+    {
+      if (scales != m_generalizationScales)
+      {
+        // the scale bands changed while generalizing
+        return;
+      }
+
+      traceResult->generalizedGeometries = generalizedGeometries;
+      traceResult->generalizationScales = scales;
+      // counted when the result is cached or added to the history if it has not been yet
+      m_traceResultCache.updateEstimatedBytes(key, traceResult);
+      m_traceHistory->updateEstimatedBytes(traceResult);
+      if (traceResult == m_currentTraceResult)
+      {
+        updateResultLevelOfDetail(true);
+      }
+    });
+  }
+
+  /*!
+    \internal
+    \brief Returns \c true if the generalized geometries of \a traceResult were generalized for the current scale bands.
+   */
+  bool UtilityNetworkTraceController::hasCurrentGeneralizations(const UtilityNetworkTraceResultCache::Entry& traceResult) const
+  {
+    return traceResult.generalizationScales == m_generalizationScales &&
+           traceResult.generalizedGeometries.size() == traceResult.geometries.size();
+  }
+
+  /*!
+    \internal
+    \brief Swaps the geometry of each result graphic to the version generalized for the current map scale.
+
+    Graphics are only touched when the map crosses into another scale band, or when \a force is \c true.
+   */
+  void UtilityNetworkTraceController::updateResultLevelOfDetail(bool force)
+  {
+    const auto mapView = qobject_cast<MapViewToolkit*>(m_geoView);
+    if (!mapView || !m_currentTraceResult)
+    {
+      return;
+    }
+
+    int levelOfDetail = -1;
+    if (m_isResultGeneralizationEnabled && hasCurrentGeneralizations(*m_currentTraceResult))
+    {
+      const auto scale = mapView->mapScale();
+      for (int i = 0; i < m_generalizationScales.size(); ++i)
       {
-        findLayer.value().append(f);
+        if (scale >= m_generalizationScales.at(i))
+        {
+          levelOfDetail = i;
+        }
       }
     }
 
-    const auto layerKeys = layerToFeatures.keys();
-    for (const auto lyr : layerKeys)
+    if (!force && levelOfDetail == m_resultLevelOfDetail)
     {
-      lyr->selectFeatures(layerToFeatures[lyr]);
+      return;
     }
+    m_resultLevelOfDetail = levelOfDetail;
 
-    setIsTraceInProgress(false);
+    const auto& geometries = m_currentTraceResult->geometries;
+    const auto& generalizedGeometries = m_currentTraceResult->generalizedGeometries;
+    for (int i = 0; i < m_resultGraphics.size() && i < geometries.size(); ++i)
+    {
+      const bool hasLevel = levelOfDetail >= 0 && i < generalizedGeometries.size() && levelOfDetail < generalizedGeometries.at(i).size();
+      m_resultGraphics.at(i)->setGeometry(hasLevel ? generalizedGeometries.at(i).at(levelOfDetail) : geometries.at(i));
+    }
+  }
+
+  /*!
+    \brief Returns whether result geometries are generalized for display according to the map scale.
+
+    When enabled, each polyline and polygon result is generalized off the GUI thread for each of
+    \l generalizationScales, and the displayed graphic geometry follows the map scale. The exact
+    geometries remain available from \l resultGeometries.
+   */
+  bool UtilityNetworkTraceController::isResultGeneralizationEnabled() const
+  {
+    return m_isResultGeneralizationEnabled;
+  }
+
+  void UtilityNetworkTraceController::setIsResultGeneralizationEnabled(bool isResultGeneralizationEnabled)
+  {
+    if (m_isResultGeneralizationEnabled == isResultGeneralizationEnabled)
+    {
+      return;
+    }
+
+    m_isResultGeneralizationEnabled = isResultGeneralizationEnabled;
+    emit isResultGeneralizationEnabledChanged();
+
+    if (m_isResultGeneralizationEnabled)
+    {
+      generalizeResultGeometries();
+    }
+    else
+    {
+      updateResultLevelOfDetail(true);
+    }
+  }
+
+  /*!
+    \brief Returns the ascending map scales at which result geometries switch to a more generalized version.
+   */
+  QList<double> UtilityNetworkTraceController::generalizationScales() const
+  {
+    return m_generalizationScales;
+  }
+
+  void UtilityNetworkTraceController::setGeneralizationScales(const QList<double>& generalizationScales)
+  {
+    auto scales = generalizationScales;
+    std::sort(std::begin(scales), std::end(scales));
+    if (m_generalizationScales == scales)
+    {
+      return;
+    }
+
+    m_generalizationScales = scales;
+    if (m_currentTraceResult)
+    {
+      // the current result must be generalized again for the new bands, cached and history entries
+      // are generalized again when they are shown, see hasCurrentGeneralizations
+      updateResultLevelOfDetail(true);
+      generalizeResultGeometries();
+    }
+  }
+
+  /*!
+    \brief Returns the exact geometry results of the current trace, regardless of what is displayed.
+   */
+  QList<Geometry> UtilityNetworkTraceController::resultGeometries() const
+  {
+    return m_currentTraceResult ? m_currentTraceResult->geometries : QList<Geometry>{};
+  }
+
+  void UtilityNetworkTraceController::applyTraceResult(const UtilityNetworkTraceResultCache::EntryPointer& traceResult)
+  {
+    m_currentTraceResult = traceResult;
+
+    for (const auto& geometry : std::as_const(traceResult->geometries))
+    {
+      addResultGraphic(geometry);
+    }
+    generalizeResultGeometries();
+
+    for (const auto& functionResult : std::as_const(traceResult->functionResults))
+    {
+      m_functionResults->addFunctionResult(functionResult);
+    }
+
+    const auto& selectedFeatures = traceResult->selectedFeatures;
+    for (auto it = selectedFeatures.cbegin(); it != selectedFeatures.cend(); ++it)
+    {
+      it.key()->selectFeatures(it.value());
+    }
+
+    setElementResultCount(traceResult->elementResultCount);
+    setIsResetResultsEnabled(true);
+  }
+
+  void UtilityNetworkTraceController::cacheCurrentTraceResult()
+  {
+    m_traceResultCache.insert(m_currentTraceResultKey, m_currentTraceResult);
+    m_traceHistory->add(m_currentTraceResultKey, m_currentTraceConfigurationName, m_currentStartingPointCount, m_currentTraceResult);
   }
 
   void UtilityNetworkTraceController::setupUtilityNetworks()
@@ -925,20 +2079,107 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
   }
 
+  /*!
+    \brief Lists the trace configurations of the selected utility network.
+
+    Configurations remembered from an earlier session or refresh are listed straight away,
+    and can be selected to validate starting points. The current configurations are then
+    queried from the service, replacing those listed and updating the remembered ones.
+   */
+  void UtilityNetworkTraceController::queryTraceConfigurations()
+  {
+    const auto cacheKey = UtilityNetworkTraceConfigurationCache::key(m_selectedUtilityNetwork);
+    m_cachedTraceConfigurations = m_traceConfigurationCache.find(cacheKey);
+    m_pendingTraceConfigurationName.clear();
+
+    if (!m_cachedTraceConfigurations.isEmpty())
+    {
+      QStringList cachedNames;
+      for (const auto& configuration : std::as_const(m_cachedTraceConfigurations))
+      {
+        cachedNames.append(configuration.name);
+      }
+
+      setTraceConfigurationNames(cachedNames);
+      m_pendingTraceConfigurationName = cachedNames.first();
+      applyStartingPointWarnings();
+    }
+
+    m_selectedUtilityNetwork->queryNamedTraceConfigurationsAsync(nullptr)
+      .then(this,
+            [this, cacheKey](const QList<UtilityNamedTraceConfiguration*>& utilityNamedTraceConfigurationResults)
+    {
+      if (cacheKey != UtilityNetworkTraceConfigurationCache::key(m_selectedUtilityNetwork))
+      {
+        // the utility network changed while querying
+        return;
+      }
+
+      m_traceConfigurations.clear();
+      m_traceConfigurations = utilityNamedTraceConfigurationResults;
+      std::sort(std::begin(m_traceConfigurations), std::end(m_traceConfigurations), [](const auto& a, const auto& b)
+      {
+        return a->name() < b->name();
+      });
+
+      m_traceConfigurationCache.insert(cacheKey, m_traceConfigurations);
+      m_cachedTraceConfigurations.clear();
+
+      QStringList traceConfigNamesTemp{};
+
+      for (const auto& traceConfig : m_traceConfigurations)
+      {
+        traceConfigNamesTemp.append(traceConfig->name());
+      }
+
+      setTraceConfigurationNames(traceConfigNamesTemp);
+
+      if (!m_traceConfigurations.isEmpty())
+      {
+        // keep the configuration picked from the cached list if it still exists, otherwise select the first one
+        const auto it = std::find_if(std::cbegin(m_traceConfigurations), std::cend(m_traceConfigurations), [this](const auto* traceConfig)
+        {
+          return traceConfig->name() == m_pendingTraceConfigurationName;
+        });
+        setSelectedTraceConfiguration(it != std::cend(m_traceConfigurations) ? *it : m_traceConfigurations.at(0));
+      }
+      m_pendingTraceConfigurationName.clear();
+    })
+      .onFailed(this, [](const ErrorException& e)
+    {
+      qDebug() << "Querying trace configurations failed" << e.error().message() << "||" << e.error().additionalMessage();
+    });
+  }
+
   void UtilityNetworkTraceController::applyStartingPointWarnings()
   {
+    auto minimumStartingLocations = UtilityMinimumStartingLocations::One;
     if (selectedTraceConfiguration() != nullptr)
     {
-      auto minimumStartingLocations = selectedTraceConfiguration()->minimumStartingLocations();
-      auto minimum = 1;
-      if (minimumStartingLocations == UtilityMinimumStartingLocations::Many)
+      minimumStartingLocations = selectedTraceConfiguration()->minimumStartingLocations();
+    }
+    else
+    {
+      // until the configurations have been queried, validate against the cached rules of the pending selection
+      const auto it = std::find_if(std::cbegin(m_cachedTraceConfigurations), std::cend(m_cachedTraceConfigurations), [this](const auto& configuration)
+      {
+        return configuration.name == m_pendingTraceConfigurationName;
+      });
+      if (it == std::cend(m_cachedTraceConfigurations))
       {
-        minimum = 2;
+        return;
       }
+      minimumStartingLocations = it->minimumStartingLocations;
+    }
 
-      setIsInsufficientStartingPoints(m_startingPoints->size() < minimum);
-      setIsAboveMinimumStartingPoint(m_startingPoints->size() > minimum);
+    auto minimum = 1;
+    if (minimumStartingLocations == UtilityMinimumStartingLocations::Many)
+    {
+      minimum = 2;
     }
+
+    setIsInsufficientStartingPoints(m_startingPoints->size() < minimum);
+    setIsAboveMinimumStartingPoint(m_startingPoints->size() > minimum);
   }
 
   void UtilityNetworkTraceController::handleArcGISAuthenticationChallenge(ArcGISAuthenticationChallenge* challenge)
@@ -18,14 +18,18 @@
 
 // Qt headers
 #include <QObject>
+#include <QUrl>
 
 // STL headers
 #include <Authentication/ArcGISAuthenticationChallengeHandler.h>
+#include <Envelope.h>
 #include <Point.h>
 
 // Other headers
 #include "GenericListModel.h"
 #include "GeoViews.h"
+#include "UtilityNetworkTraceConfigurationCache.h"
+#include "UtilityNetworkTraceResultCache.h"
 
 Q_MOC_INCLUDE("UtilityNetwork.h")
 Q_MOC_INCLUDE("UtilityNetworkTraceStartingPoint.h")
@@ -37,22 +41,30 @@ namespace Esri::ArcGISRuntime
 
   class ArcGISFeature;
   class ErrorException;
+  class FeatureLayer;
+  class FeatureQueryResult;
+  class GeoElement;
+  class Graphic;
   class GraphicsOverlay;
   class SimpleFillSymbol;
   class SimpleLineSymbol;
   class SimpleMarkerSymbol;
   class Symbol;
+  class UtilityElement;
   class UtilityElementTraceResult;
   class UtilityNamedTraceConfiguration;
   class UtilityNetwork;
   class UtilityNetworkListModel;
   class UtilityTraceParameters;
+  class UtilityTraceResult;
   class UtilityTraceResultListModel;
 
   namespace Toolkit
   {
 
     class UtilityNetworkFunctionTraceResultsModel;
+    class UtilityNetworkTraceHistoryModel;
+    class UtilityNetworkTraceResultExporter;
     class UtilityNetworkTraceStartingPoint;
     class UtilityNetworkTraceStartingPointsModel;
 
@@ -69,6 +81,8 @@ namespace Esri::ArcGISRuntime
                    isAddingStartingPointEnabledChanged)
       Q_PROPERTY(bool isAddingStartingPointInProgress READ isAddingStartingPointInProgress WRITE setIsAddingStartingPointInProgress NOTIFY
                    isAddingStartingPointInProgressChanged)
+      Q_PROPERTY(bool isSingleStartingPointPickEnabled READ isSingleStartingPointPickEnabled WRITE setIsSingleStartingPointPickEnabled NOTIFY
+                   isSingleStartingPointPickEnabledChanged)
       Q_PROPERTY(Symbol* startingPointSymbol READ startingPointSymbol WRITE setStartingPointSymbol NOTIFY startingPointSymbolChanged)
       Q_PROPERTY(QAbstractItemModel* startingPoints READ startingPoints CONSTANT)
       Q_PROPERTY(QAbstractItemModel* functionResults READ functionResults CONSTANT)
@@ -78,6 +92,27 @@ namespace Esri::ArcGISRuntime
       Q_PROPERTY(bool isAboveMinimumStartingPoint READ isAboveMinimumStartingPoint WRITE setIsAboveMinimumStartingPoint NOTIFY
                    isAboveMinimumStartingPointChanged)
       Q_PROPERTY(bool isResetResultsEnabled READ isResetResultsEnabled WRITE setIsResetResultsEnabled NOTIFY isResetResultsEnabledChanged)
+      Q_PROPERTY(bool isElementSelectionInProgress READ isElementSelectionInProgress NOTIFY isElementSelectionInProgressChanged)
+      Q_PROPERTY(double elementSelectionProgress READ elementSelectionProgress NOTIFY elementSelectionProgressChanged)
+      Q_PROPERTY(int elementResultCount READ elementResultCount NOTIFY elementResultCountChanged)
+      Q_PROPERTY(bool isElementResultAboveSelectionLimit READ isElementResultAboveSelectionLimit NOTIFY elementResultCountChanged)
+      Q_PROPERTY(int elementSelectionChunkSize READ elementSelectionChunkSize WRITE setElementSelectionChunkSize NOTIFY
+                   elementSelectionChunkSizeChanged)
+      Q_PROPERTY(int maximumSelectableElements READ maximumSelectableElements WRITE setMaximumSelectableElements NOTIFY
+                   maximumSelectableElementsChanged)
+      Q_PROPERTY(QAbstractItemModel* traceRuns READ traceRuns CONSTANT)
+      Q_PROPERTY(bool isParallelTraceInProgress READ isParallelTraceInProgress NOTIFY isParallelTraceInProgressChanged)
+      Q_PROPERTY(bool isResultGeneralizationEnabled READ isResultGeneralizationEnabled WRITE setIsResultGeneralizationEnabled NOTIFY
+                   isResultGeneralizationEnabledChanged)
+      Q_PROPERTY(qint64 traceResultCacheMaximumBytes READ traceResultCacheMaximumBytes WRITE setTraceResultCacheMaximumBytes NOTIFY
+                   traceResultCacheMaximumBytesChanged)
+      Q_PROPERTY(QAbstractItemModel* traceHistory READ traceHistory CONSTANT)
+      Q_PROPERTY(int maximumTraceHistoryCount READ maximumTraceHistoryCount WRITE setMaximumTraceHistoryCount NOTIFY
+                   maximumTraceHistoryCountChanged)
+      Q_PROPERTY(qint64 traceHistoryMaximumBytes READ traceHistoryMaximumBytes WRITE setTraceHistoryMaximumBytes NOTIFY
+                   traceHistoryMaximumBytesChanged)
+      Q_PROPERTY(bool isExportInProgress READ isExportInProgress NOTIFY isExportInProgressChanged)
+      Q_PROPERTY(double exportProgress READ exportProgress NOTIFY exportProgressChanged)
 
     public:
       Q_INVOKABLE explicit UtilityNetworkTraceController(QObject* parent = nullptr);
@@ -109,6 +144,9 @@ namespace Esri::ArcGISRuntime
       bool isAddingStartingPointInProgress() const;
       void setIsAddingStartingPointInProgress(const bool isAddingStartingPointInProgress);
 
+      bool isSingleStartingPointPickEnabled() const;
+      void setIsSingleStartingPointPickEnabled(bool isSingleStartingPointPickEnabled);
+
       Symbol* startingPointSymbol() const;
       void setStartingPointSymbol(Symbol* startingPointSymbol);
 
@@ -121,6 +159,49 @@ namespace Esri::ArcGISRuntime
       bool isResetResultsEnabled() const;
       void setIsResetResultsEnabled(bool isResetResultsEnabled);
 
+      bool isElementSelectionInProgress() const;
+
+      double elementSelectionProgress() const;
+
+      int elementResultCount() const;
+
+      bool isElementResultAboveSelectionLimit() const;
+
+      Envelope elementResultExtent() const;
+
+      int elementSelectionChunkSize() const;
+      void setElementSelectionChunkSize(int elementSelectionChunkSize);
+
+      int maximumSelectableElements() const;
+      void setMaximumSelectableElements(int maximumSelectableElements);
+
+      bool isResultGeneralizationEnabled() const;
+      void setIsResultGeneralizationEnabled(bool isResultGeneralizationEnabled);
+
+      QList<double> generalizationScales() const;
+      void setGeneralizationScales(const QList<double>& generalizationScales);
+
+      QList<Geometry> resultGeometries() const;
+
+      qint64 traceResultCacheMaximumBytes() const;
+      void setTraceResultCacheMaximumBytes(qint64 traceResultCacheMaximumBytes);
+
+      QAbstractItemModel* traceHistory() const;
+
+      int maximumTraceHistoryCount() const;
+      void setMaximumTraceHistoryCount(int maximumTraceHistoryCount);
+
+      qint64 traceHistoryMaximumBytes() const;
+      void setTraceHistoryMaximumBytes(qint64 traceHistoryMaximumBytes);
+
+      QAbstractItemModel* traceRuns() const;
+
+      bool isParallelTraceInProgress() const;
+
+      bool isExportInProgress() const;
+
+      double exportProgress() const;
+
       Q_INVOKABLE void runTrace(const QString& name);
 
       QList<Esri::ArcGISRuntime::UtilityNamedTraceConfiguration*> traceConfigurations() const;
@@ -139,6 +220,24 @@ namespace Esri::ArcGISRuntime
 
       Q_INVOKABLE void resetTraceResults();
 
+      Q_INVOKABLE void cancelElementSelection();
+
+      Q_INVOKABLE void showTraceHistoryEntry(int index);
+
+      Q_INVOKABLE void clearTraceHistory();
+
+      Q_INVOKABLE void runTraces(const QStringList& names);
+
+      Q_INVOKABLE void clearTraceRuns();
+
+      Q_INVOKABLE bool exportTraceResults(const QUrl& fileUrl);
+
+      Q_INVOKABLE void cancelExport();
+
+      void addStartingPoints(const Geometry& geometry);
+      void addStartingPoints(const QList<FeatureQueryResult*>& queryResults);
+      void addStartingPoints(const QList<ArcGISFeature*>& features);
+
     signals:
       void geoViewChanged();
       void selectedUtilityNetworkChanged(Esri::ArcGISRuntime::UtilityNetwork* newValue);
@@ -149,18 +248,50 @@ namespace Esri::ArcGISRuntime
       void isAddingStartingPointEnabledChanged();
       void isAddingStartingPointInProgressChanged();
       void startingPointSymbolChanged();
+      void isSingleStartingPointPickEnabledChanged();
       void isInsufficientStartingPointsChanged();
       void isAboveMinimumStartingPointChanged();
       void isResetResultsEnabledChanged();
+      void isElementSelectionInProgressChanged();
+      void elementSelectionProgressChanged();
+      void elementResultCountChanged();
+      void elementSelectionChunkSizeChanged();
+      void maximumSelectableElementsChanged();
+      void traceResultCacheMaximumBytesChanged();
+      void maximumTraceHistoryCountChanged();
+      void traceHistoryMaximumBytesChanged();
+      void isResultGeneralizationEnabledChanged();
+      void isParallelTraceInProgressChanged();
+      void traceRunsCompleted();
+      void isExportInProgressChanged();
+      void exportProgressChanged();
+      void exportCompleted(bool success, const QString& errorMessage);
 
     private slots:
-      void onTraceCompleted();
+      void onTraceCompleted(const QList<Esri::ArcGISRuntime::UtilityTraceResult*>& results);
       void onSelectedUtilityNetworkError(const Esri::ArcGISRuntime::ErrorException& e);
-      void onFeaturesForElementsCompleted();
 
     private:
+      void selectNextElementChunk(quint64 traceGeneration);
+      void onFeaturesForElementsCompleted(quint64 traceGeneration, const QList<ArcGISFeature*>& features);
+      void setIsElementSelectionInProgress(bool isElementSelectionInProgress);
+      void setElementSelectionProgress(double elementSelectionProgress);
+      void setElementResultCount(int elementResultCount);
+      void addResultGraphic(const Geometry& geometry);
+      void generalizeResultGeometries();
+      bool hasCurrentGeneralizations(const UtilityNetworkTraceResultCache::Entry& traceResult) const;
+      void updateResultLevelOfDetail(bool force);
+      void applyTraceResult(const UtilityNetworkTraceResultCache::EntryPointer& traceResult);
+      void cacheCurrentTraceResult();
+      void setIsParallelTraceInProgress(bool isParallelTraceInProgress);
+      void setExportProgress(double exportProgress);
       void addStartingPoint(ArcGISFeature* identifiedFeature, const Point& mapPoint);
+      bool addFirstStartingPoint(const QList<GeoElement*>& geoElements);
+      UtilityNetworkTraceStartingPoint* createStartingPoint(ArcGISFeature* feature, const Point& mapPoint, QSet<QString>& addedElementKeys);
+      QList<FeatureLayer*> utilityNetworkFeatureLayers() const;
+      void identifyStartingPoints(MapViewToolkit* mapView, const QPointF& screenPoint);
       void setupUtilityNetworks();
+      void queryTraceConfigurations();
       void applyStartingPointWarnings();
       void handleArcGISAuthenticationChallenge(Authentication::ArcGISAuthenticationChallenge* challenge) override;
 
@@ -171,12 +302,19 @@ namespace Esri::ArcGISRuntime
       QStringList m_traceConfigurationNames;
       QList<UtilityNamedTraceConfiguration*> m_traceConfigurations;
       UtilityNamedTraceConfiguration* m_selectedTraceConfiguration = nullptr;
+      // configurations last seen for the selected utility network, listed until the query for the current ones completes
+      UtilityNetworkTraceConfigurationCache m_traceConfigurationCache;
+      QList<UtilityNetworkTraceConfigurationCache::Configuration> m_cachedTraceConfigurations;
+      QString m_pendingTraceConfigurationName; // selected from the cached configurations before the query completed
       UtilityNetworkTraceStartingPointsModel* m_startingPoints;
       UtilityNetworkFunctionTraceResultsModel* m_functionResults;
       UtilityTraceResultListModel* m_traceResults = nullptr;
       bool m_isTraceInProgress = false;
       bool m_isAddingStartingPointEnabled = false; // if so, user can select points on the map to become starting points
       bool m_isAddingStartingPointInProgress = false; // if so, it's processing selected points on the map to be starting points
+      bool m_isSingleStartingPointPickEnabled = false; // if so, a click adds at most one starting point
+      // bumped by each click or geometry adding starting points, and when they are cleared, so late results are dropped
+      quint64 m_startingPointGeneration = 0;
       Symbol* m_startingPointSymbol;
       Point m_mapPoint;
       bool m_isInsufficientStartingPoints = true; // during initialization, it cannot be sufficient
@@ -185,6 +323,43 @@ namespace Esri::ArcGISRuntime
       UtilityTraceParameters* m_utilityTraceParameters = nullptr;
       GraphicsOverlay* m_resultsGraphicsOverlay = nullptr;
 
+      // element results are resolved to features and selected in chunks of this size
+      int m_elementSelectionChunkSize = 1000;
+      // above this many elements only the count and extent are reported, nothing is selected
+      int m_maximumSelectableElements = 50000;
+      // incremented whenever a trace starts or its results are reset, so stale continuations can bail out
+      quint64 m_traceGeneration = 0;
+      QList<UtilityElement*> m_pendingElements;
+      qsizetype m_nextElementIndex = 0;
+      qsizetype m_resolvedElementCount = 0;
+      bool m_isElementSelectionInProgress = false;
+      double m_elementSelectionProgress = 0.0;
+      int m_elementResultCount = 0;
+
+      // the results currently displayed, shared with m_traceResultCache once the trace has fully completed
+      UtilityNetworkTraceResultCache::EntryPointer m_currentTraceResult;
+      QString m_currentTraceResultKey;
+      QString m_currentTraceConfigurationName;
+      int m_currentStartingPointCount = 0;
+      UtilityNetworkTraceResultCache m_traceResultCache{64 * 1024 * 1024};
+      // the last completed traces, which can be shown again without re-running them
+      UtilityNetworkTraceHistoryModel* m_traceHistory = nullptr;
+
+      // result graphics are drawn with geometries generalized for the scale band the map is in
+      bool m_isResultGeneralizationEnabled = false;
+      QList<double> m_generalizationScales{10000.0, 50000.0, 250000.0, 1000000.0};
+      QList<Graphic*> m_resultGraphics; // parallel to m_currentTraceResult->geometries
+      int m_resultLevelOfDetail = -1; // index into m_generalizationScales, -1 for the exact geometries
+
+      // trace configurations run side by side, each drawing into its own graphics overlay
+      GenericListModel* m_traceRuns = nullptr;
+      int m_pendingTraceRuns = 0;
+      bool m_isParallelTraceInProgress = false;
+
+      // writes the current trace result to a file, null when no export is running
+      UtilityNetworkTraceResultExporter* m_exporter = nullptr;
+      double m_exportProgress = 0.0;
+
       // these won't get refreshed in refresh() because they shouldn't change
       SimpleMarkerSymbol* m_resultPointSymbol = nullptr;
       SimpleLineSymbol* m_resultLineSymbol = nullptr;
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "UtilityNetworkTraceHistoryModel.h"
+
+// Qt headers
+#include <QDebug>
+
+// std headers
+#include <algorithm>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::UtilityNetworkTraceHistoryModel
+    \brief The most recent trace results, newest first, bounded by a count and an approximate memory budget.
+
+    Each row shares the displayed result with the trace result cache, so showing an
+    earlier trace again needs neither the service nor feature resolution. When the
+    budget is exceeded, the least recently shown rows are removed first.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  UtilityNetworkTraceHistoryModel::UtilityNetworkTraceHistoryModel(QObject* parent) :
+    QAbstractListModel(parent)
+  {
+  }
+
+  int UtilityNetworkTraceHistoryModel::rowCount(const QModelIndex& /*parent*/) const
+  {
+    return static_cast<int>(m_data.size());
+  }
+
+  QVariant UtilityNetworkTraceHistoryModel::data(const QModelIndex& index, int role) const
+  {
+    if (index.row() < 0 || index.row() >= rowCount())
+    {
+      return QVariant();
+    }
+
+    const auto& entry = m_data.at(index.row());
+
+    switch (role)
+    {
+      case NameRole:
+        return entry.name;
+      case StartingPointCountRole:
+        return entry.startingPointCount;
+      case ElementResultCountRole:
+        return entry.traceResult->elementResultCount;
+      case CompletedAtRole:
+        return entry.completedAt;
+      default:
+        qDebug() << "Incorrect UtilityNetworkTraceHistoryModel data.";
+    }
+
+    return {};
+  }
+
+  /*!
+    \brief Adds \a traceResult as the newest row, or marks it as used if a row with \a key already holds it.
+   */
+  void UtilityNetworkTraceHistoryModel::add(const QString& key,
+                                            const QString& name,
+                                            int startingPointCount,
+                                            UtilityNetworkTraceResultCache::EntryPointer traceResult)
+  {
+    if (!traceResult)
+    {
+      return;
+    }
+
+    const auto it = std::find_if(m_data.begin(), m_data.end(), [&key](const auto& entry)
+    {
+      return !key.isEmpty() && entry.key == key;
+    });
+
+    if (it != m_data.end() && it->traceResult == traceResult)
+    {
+      it->lastUsed = ++m_useCounter;
+      return;
+    }
+
+    if (it != m_data.end())
+    {
+      // the same trace ran again, the earlier row is replaced by the new one
+      const auto row = static_cast<int>(std::distance(m_data.begin(), it));
+      beginRemoveRows(QModelIndex(), row, row);
+      m_totalBytes -= it->bytes;
+      m_data.erase(it);
+      endRemoveRows();
+    }
+
+    HistoryEntry entry;
+    entry.key = key;
+    entry.name = name;
+    entry.startingPointCount = startingPointCount;
+    entry.completedAt = QDateTime::currentDateTime();
+    entry.bytes = traceResult->estimatedBytes();
+    entry.traceResult = std::move(traceResult);
+    entry.lastUsed = ++m_useCounter;
+
+    beginInsertRows(QModelIndex(), 0, 0);
+    m_totalBytes += entry.bytes;
+    m_data.prepend(std::move(entry));
+    endInsertRows();
+
+    evict();
+  }
+
+  /*!
+    \brief Returns the result shown by \a row and marks it as the most recently used, or \c nullptr for an invalid row.
+   */
+  UtilityNetworkTraceResultCache::EntryPointer UtilityNetworkTraceHistoryModel::traceResult(int row)
+  {
+    if (row < 0 || row >= rowCount())
+    {
+      return nullptr;
+    }
+
+    auto& entry = m_data[row];
+    entry.lastUsed = ++m_useCounter;
+    return entry.traceResult;
+  }
+
+  /*!
+    \brief Recomputes the size of the row holding \a traceResult, if any, after data was added to it.
+
+    The least recently used rows which no longer fit in the budget are evicted.
+   */
+  void UtilityNetworkTraceHistoryModel::updateEstimatedBytes(const UtilityNetworkTraceResultCache::EntryPointer& traceResult)
+  {
+    const auto it = std::find_if(m_data.begin(), m_data.end(), [&traceResult](const auto& entry)
+    {
+      return entry.traceResult == traceResult;
+    });
+
+    if (!traceResult || it == m_data.end())
+    {
+      return;
+    }
+
+    const auto bytes = traceResult->estimatedBytes();
+    m_totalBytes += bytes - it->bytes;
+    it->bytes = bytes;
+
+    evict();
+  }
+
+  QString UtilityNetworkTraceHistoryModel::key(int row) const
+  {
+    return row >= 0 && row < rowCount() ? m_data.at(row).key : QString{};
+  }
+
+  QString UtilityNetworkTraceHistoryModel::name(int row) const
+  {
+    return row >= 0 && row < rowCount() ? m_data.at(row).name : QString{};
+  }
+
+  int UtilityNetworkTraceHistoryModel::startingPointCount(int row) const
+  {
+    return row >= 0 && row < rowCount() ? m_data.at(row).startingPointCount : 0;
+  }
+
+  void UtilityNetworkTraceHistoryModel::clear()
+  {
+    beginResetModel();
+    m_data.clear();
+    m_totalBytes = 0;
+    endResetModel();
+  }
+
+  int UtilityNetworkTraceHistoryModel::maximumCount() const
+  {
+    return m_maximumCount;
+  }
+
+  void UtilityNetworkTraceHistoryModel::setMaximumCount(int maximumCount)
+  {
+    m_maximumCount = std::max(1, maximumCount);
+    evict();
+  }
+
+  qint64 UtilityNetworkTraceHistoryModel::maximumBytes() const
+  {
+    return m_maximumBytes;
+  }
+
+  void UtilityNetworkTraceHistoryModel::setMaximumBytes(qint64 maximumBytes)
+  {
+    m_maximumBytes = maximumBytes;
+    evict();
+  }
+
+  QHash<int, QByteArray> UtilityNetworkTraceHistoryModel::roleNames() const
+  {
+    return {
+      {NameRole, "name"},
+      {StartingPointCountRole, "startingPointCount"},
+      {ElementResultCountRole, "elementResultCount"},
+      {CompletedAtRole, "completedAt"},
+    };
+  }
+
+  void UtilityNetworkTraceHistoryModel::evict()
+  {
+    // the most recently used row always stays, however large it is
+    while (m_data.size() > 1 && (m_data.size() > m_maximumCount || m_totalBytes > m_maximumBytes))
+    {
+      const auto it = std::min_element(m_data.cbegin(), m_data.cend(), [](const auto& a, const auto& b)
+      {
+        return a.lastUsed < b.lastUsed;
+      });
+
+      const auto row = static_cast<int>(std::distance(m_data.cbegin(), it));
+      beginRemoveRows(QModelIndex(), row, row);
+      m_totalBytes -= it->bytes;
+      // the result itself is only destroyed once nothing else is displaying or caching it
+      m_data.removeAt(row);
+      endRemoveRows();
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACEHISTORYMODEL_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACEHISTORYMODEL_H
+
+// Qt headers
+#include <QAbstractListModel>
+#include <QDateTime>
+
+// Other headers
+#include "UtilityNetworkTraceResultCache.h"
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class UtilityNetworkTraceHistoryModel : public QAbstractListModel
+  {
+    Q_OBJECT
+
+  public:
+    explicit UtilityNetworkTraceHistoryModel(QObject* parent = nullptr);
+
+    enum TraceHistoryRoles
+    {
+      NameRole = Qt::UserRole + 1,
+      StartingPointCountRole = Qt::UserRole + 2,
+      ElementResultCountRole = Qt::UserRole + 3,
+      CompletedAtRole = Qt::UserRole + 4,
+    };
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    void add(const QString& key, const QString& name, int startingPointCount, UtilityNetworkTraceResultCache::EntryPointer traceResult);
+
+    UtilityNetworkTraceResultCache::EntryPointer traceResult(int row);
+
+    void updateEstimatedBytes(const UtilityNetworkTraceResultCache::EntryPointer& traceResult);
+
+    QString key(int row) const;
+
+    QString name(int row) const;
+
+    int startingPointCount(int row) const;
+
+    void clear();
+
+    int maximumCount() const;
+    void setMaximumCount(int maximumCount);
+
+    qint64 maximumBytes() const;
+    void setMaximumBytes(qint64 maximumBytes);
+
+  private:
+    struct HistoryEntry
+    {
+      QString key;
+      QString name;
+      int startingPointCount = 0;
+      QDateTime completedAt;
+      UtilityNetworkTraceResultCache::EntryPointer traceResult;
+      qint64 bytes = 0;
+      quint64 lastUsed = 0;
+    };
+
+    QHash<int, QByteArray> roleNames() const override;
+
+    void evict();
+
+    QList<HistoryEntry> m_data; // newest trace first
+    int m_maximumCount = 10;
+    qint64 m_maximumBytes = 128 * 1024 * 1024;
+    qint64 m_totalBytes = 0;
+    quint64 m_useCounter = 0;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACEHISTORYMODEL_H
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "UtilityNetworkTraceResultCache.h"
+
+// ArcGISRuntime headers
+#include <Feature.h>
+#include <ImmutablePart.h>
+#include <ImmutablePartCollection.h>
+#include <ImmutablePointCollection.h>
+#include <Multipart.h>
+#include <Multipoint.h>
+#include <UtilityElement.h>
+#include <UtilityNamedTraceConfiguration.h>
+#include <UtilityNetwork.h>
+#include <UtilityNetworkSource.h>
+#include <UtilityTerminal.h>
+
+// Qt headers
+#include <QObject>
+#include <QStringList>
+#include <QUuid>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    // Rough per-object costs used to keep the cache within its memory budget.
+    constexpr qint64 bytesPerVertex = 3 * sizeof(double);
+    constexpr qint64 bytesPerFeature = 1024;
+    constexpr qint64 bytesPerElement = 256;
+
+    qint64 vertexCount(const Geometry& geometry)
+    {
+      switch (geometry.geometryType())
+      {
+        case GeometryType::Multipoint:
+          return geometry_cast<Multipoint>(geometry).points().size();
+        case GeometryType::Polyline:
+        case GeometryType::Polygon:
+        {
+          const auto parts = geometry_cast<Multipart>(geometry).parts();
+          qint64 count = 0;
+          for (int i = 0; i < parts.size(); ++i)
+          {
+            count += parts.part(i).pointCount();
+          }
+          return count;
+        }
+        default:
+          return 1;
+      }
+    }
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::UtilityNetworkTraceResultCache
+    \brief A least recently used cache of completed trace results, bounded by an approximate memory budget.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  UtilityNetworkTraceResultCache::Entry::Entry() :
+    resultsParent(new QObject())
+  {
+  }
+
+  UtilityNetworkTraceResultCache::Entry::~Entry()
+  {
+    delete resultsParent;
+  }
+
+  /*!
+    \brief Returns an approximation of the memory held by this entry.
+   */
+  qint64 UtilityNetworkTraceResultCache::Entry::estimatedBytes() const
+  {
+    qint64 bytes = sizeof(Entry);
+
+    for (const auto& geometry : geometries)
+    {
+      bytes += vertexCount(geometry) * bytesPerVertex;
+    }
+
+    for (const auto& levels : generalizedGeometries)
+    {
+      for (const auto& geometry : levels)
+      {
+        bytes += vertexCount(geometry) * bytesPerVertex;
+      }
+    }
+
+    bytes += functionResults.size() * static_cast<qint64>(sizeof(UtilityNetworkFunctionTraceResult));
+    bytes += elements.size() * bytesPerElement;
+
+    for (const auto& features : selectedFeatures)
+    {
+      bytes += features.size() * bytesPerFeature;
+    }
+
+    return bytes;
+  }
+
+  UtilityNetworkTraceResultCache::UtilityNetworkTraceResultCache(qint64 maximumBytes) :
+    m_maximumBytes(maximumBytes)
+  {
+  }
+
+  /*!
+    \brief Returns the cache key for tracing \a traceConfiguration on \a utilityNetwork from \a startingPoints.
+
+    The order of the starting points, their terminals and their fraction along edge all contribute to the key.
+   */
+  QString UtilityNetworkTraceResultCache::key(UtilityNetwork* utilityNetwork,
+                                              UtilityNamedTraceConfiguration* traceConfiguration,
+                                              const QList<UtilityElement*>& startingPoints)
+  {
+    if (!utilityNetwork || !traceConfiguration)
+    {
+      return {};
+    }
+
+    QStringList parts;
+    parts.reserve(startingPoints.size() + 2);
+    parts.append(utilityNetwork->uri().toString());
+    parts.append(traceConfiguration->globalId().toString(QUuid::WithoutBraces));
+
+    for (const auto element : startingPoints)
+    {
+      const auto terminal = element->terminal();
+      parts.append(QStringLiteral("%1:%2:%3:%4")
+                     .arg(element->networkSource()->sourceId())
+                     .arg(element->globalId().toString(QUuid::WithoutBraces))
+                     .arg(terminal ? terminal->terminalId() : -1)
+                     .arg(element->fractionAlongEdge(), 0, 'g', 17));
+    }
+
+    return parts.join(QLatin1Char('|'));
+  }
+
+  /*!
+    \brief Returns the entry stored under \a key, or \c nullptr if there is none.
+
+    A successful lookup marks the entry as most recently used.
+   */
+  UtilityNetworkTraceResultCache::EntryPointer UtilityNetworkTraceResultCache::find(const QString& key)
+  {
+    const auto it = m_entries.constFind(key);
+    if (it == m_entries.cend())
+    {
+      return nullptr;
+    }
+
+    m_recentKeys.removeOne(key);
+    m_recentKeys.prepend(key);
+    return it.value();
+  }
+
+  /*!
+    \brief Stores \a entry under \a key, evicting the least recently used entries which no longer fit in the budget.
+
+    Entries larger than the whole budget are not stored.
+   */
+  void UtilityNetworkTraceResultCache::insert(const QString& key, EntryPointer entry)
+  {
+    if (key.isEmpty() || !entry)
+    {
+      return;
+    }
+
+    const auto bytes = entry->estimatedBytes();
+    if (bytes > m_maximumBytes)
+    {
+      return;
+    }
+
+    if (m_entries.contains(key))
+    {
+      m_totalBytes -= m_entryBytes.value(key);
+      m_recentKeys.removeOne(key);
+    }
+
+    m_entries.insert(key, std::move(entry));
+    m_entryBytes.insert(key, bytes);
+    m_recentKeys.prepend(key);
+    m_totalBytes += bytes;
+
+    evict();
+  }
+
+  /*!
+    \brief Recomputes the size of \a entry if it is stored under \a key, after data was added to it.
+
+    The least recently used entries which no longer fit in the budget are evicted, which may include \a entry itself.
+   */
+  void UtilityNetworkTraceResultCache::updateEstimatedBytes(const QString& key, const EntryPointer& entry)
+  {
+    if (!entry || m_entries.value(key) != entry)
+    {
+      return;
+    }
+
+    const auto bytes = entry->estimatedBytes();
+    m_totalBytes += bytes - m_entryBytes.value(key);
+    m_entryBytes.insert(key, bytes);
+
+    evict();
+  }
+
+  void UtilityNetworkTraceResultCache::clear()
+  {
+    m_entries.clear();
+    m_entryBytes.clear();
+    m_recentKeys.clear();
+    m_totalBytes = 0;
+  }
+
+  qint64 UtilityNetworkTraceResultCache::maximumBytes() const
+  {
+    return m_maximumBytes;
+  }
+
+  void UtilityNetworkTraceResultCache::setMaximumBytes(qint64 maximumBytes)
+  {
+    m_maximumBytes = maximumBytes;
+    evict();
+  }
+
+  qint64 UtilityNetworkTraceResultCache::totalBytes() const
+  {
+    return m_totalBytes;
+  }
+
+  void UtilityNetworkTraceResultCache::evict()
+  {
+    while (m_totalBytes > m_maximumBytes && !m_recentKeys.isEmpty())
+    {
+      const auto key = m_recentKeys.takeLast();
+      m_totalBytes -= m_entryBytes.take(key);
+      // the entry itself is only destroyed once nothing else is displaying it
+      m_entries.remove(key);
+    }
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
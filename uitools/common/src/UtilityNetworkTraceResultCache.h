@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERESULTCACHE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERESULTCACHE_H
+
+// Qt headers
+#include <QHash>
+#include <QList>
+#include <QString>
+
+// STL headers
+#include <Envelope.h>
+#include <Geometry.h>
+
+// Other headers
+#include "UtilityNetworkFunctionTraceResult.h"
+
+// std headers
+#include <memory>
+
+namespace Esri::ArcGISRuntime
+{
+  class Feature;
+  class FeatureLayer;
+  class UtilityElement;
+  class UtilityNamedTraceConfiguration;
+  class UtilityNetwork;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class UtilityNetworkTraceResultCache
+  {
+  public:
+    // Everything the trace controller displays for a single completed trace.
+    struct Entry
+    {
+      Entry();
+      ~Entry();
+
+      Entry(const Entry&) = delete;
+      Entry& operator=(const Entry&) = delete;
+
+      QList<Geometry> geometries;
+      // for each of geometries, its generalized versions per scale band, empty if not generalized
+      QList<QList<Geometry>> generalizedGeometries;
+      // the scale bands generalizedGeometries were generalized for, stale if they differ from the controller's
+      QList<double> generalizationScales;
+      QList<UtilityNetworkFunctionTraceResult> functionResults;
+      // owned by the trace results in resultsParent
+      QList<UtilityElement*> elements;
+      QHash<FeatureLayer*, QList<Feature*>> selectedFeatures;
+      // owns the trace results and every feature in selectedFeatures
+      QObject* resultsParent = nullptr;
+      int elementResultCount = 0;
+      Envelope elementResultExtent;
+
+      qint64 estimatedBytes() const;
+    };
+
+    using EntryPointer = std::shared_ptr<Entry>;
+
+    explicit UtilityNetworkTraceResultCache(qint64 maximumBytes);
+
+    static QString key(UtilityNetwork* utilityNetwork,
+                       UtilityNamedTraceConfiguration* traceConfiguration,
+                       const QList<UtilityElement*>& startingPoints);
+
+    EntryPointer find(const QString& key);
+
+    void insert(const QString& key, EntryPointer entry);
+
+    void updateEstimatedBytes(const QString& key, const EntryPointer& entry);
+
+    void clear();
+
+    qint64 maximumBytes() const;
+    void setMaximumBytes(qint64 maximumBytes);
+
+    qint64 totalBytes() const;
+
+  private:
+    void evict();
+
+    QHash<QString, EntryPointer> m_entries;
+    QHash<QString, qint64> m_entryBytes;
+    // most recently used key first
+    QList<QString> m_recentKeys;
+    qint64 m_maximumBytes = 0;
+    qint64 m_totalBytes = 0;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERESULTCACHE_H
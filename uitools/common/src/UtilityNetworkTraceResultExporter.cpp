@@ -0,0 +1,562 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "UtilityNetworkTraceResultExporter.h"
+
+// ArcGISRuntime headers
+#include <ArcGISFeature.h>
+#include <ArcGISFeatureTable.h>
+#include <AttributeListModel.h>
+#include <Error.h>
+#include <ErrorException.h>
+#include <GeometryEngine.h>
+#include <ImmutablePart.h>
+#include <ImmutablePartCollection.h>
+#include <ImmutablePointCollection.h>
+#include <Layer.h>
+#include <Multipart.h>
+#include <Multipoint.h>
+#include <Point.h>
+#include <SpatialReference.h>
+#include <UtilityAssetGroup.h>
+#include <UtilityAssetType.h>
+#include <UtilityElement.h>
+#include <UtilityNetwork.h>
+#include <UtilityNetworkSource.h>
+#include <UtilityTerminal.h>
+
+// Toolkit headers
+#include "UtilityNetworkFunctionTraceResult.h"
+
+// Qt headers
+#include <QFuture>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStringList>
+#include <QTimer>
+#include <QUuid>
+
+// std headers
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  namespace
+  {
+    const QString csvHeader = QStringLiteral("resultType,name,globalId,networkSource,assetGroup,assetType,terminal,layer,value,geometry");
+
+    QString csvField(const QString& value)
+    {
+      if (!value.contains(QLatin1Char(',')) && !value.contains(QLatin1Char('"')) && !value.contains(QLatin1Char('\n')))
+      {
+        return value;
+      }
+
+      QString escaped = value;
+      escaped.replace(QLatin1Char('"'), QLatin1String("\"\""));
+      return QLatin1Char('"') + escaped + QLatin1Char('"');
+    }
+
+    void writeCoordinate(QTextStream& stream, const Point& point)
+    {
+      stream << '[' << QString::number(point.x(), 'g', 12) << ',' << QString::number(point.y(), 'g', 12) << ']';
+    }
+
+    void writePoints(QTextStream& stream, const ImmutablePart& part)
+    {
+      stream << '[';
+      for (qsizetype i = 0; i < part.pointCount(); ++i)
+      {
+        if (i > 0)
+        {
+          stream << ',';
+        }
+        writeCoordinate(stream, part.point(i));
+      }
+      stream << ']';
+    }
+
+    void writeParts(QTextStream& stream, const Multipart& multipart)
+    {
+      const auto parts = multipart.parts();
+      stream << '[';
+      for (qsizetype i = 0; i < parts.size(); ++i)
+      {
+        if (i > 0)
+        {
+          stream << ',';
+        }
+        writePoints(stream, parts.part(i));
+      }
+      stream << ']';
+    }
+
+    // The vertices of a polygon ring, closed as GeoJSON requires.
+    QList<Point> ringPoints(const ImmutablePart& part)
+    {
+      QList<Point> points;
+      points.reserve(part.pointCount() + 1);
+      for (qsizetype i = 0; i < part.pointCount(); ++i)
+      {
+        points.append(part.point(i));
+      }
+
+      if (!points.isEmpty() && (points.first().x() != points.last().x() || points.first().y() != points.last().y()))
+      {
+        points.append(points.first());
+      }
+      return points;
+    }
+
+    // Twice the area enclosed by a closed ring, positive if it is wound counter-clockwise.
+    double signedArea(const QList<Point>& ring)
+    {
+      double area = 0.0;
+      for (qsizetype i = 1; i < ring.size(); ++i)
+      {
+        area += ring.at(i - 1).x() * ring.at(i).y() - ring.at(i).x() * ring.at(i - 1).y();
+      }
+      return area;
+    }
+
+    bool ringContains(const QList<Point>& ring, const Point& point)
+    {
+      bool isInside = false;
+      for (qsizetype i = 1; i < ring.size(); ++i)
+      {
+        const auto& a = ring.at(i - 1);
+        const auto& b = ring.at(i);
+        if ((a.y() > point.y()) != (b.y() > point.y()) &&
+            point.x() < (b.x() - a.x()) * (point.y() - a.y()) / (b.y() - a.y()) + a.x())
+        {
+          isInside = !isInside;
+        }
+      }
+      return isInside;
+    }
+
+    void writeRing(QTextStream& stream, const QList<Point>& ring, bool isCounterClockwise)
+    {
+      const bool isReversed = (signedArea(ring) > 0.0) != isCounterClockwise;
+      stream << '[';
+      for (qsizetype i = 0; i < ring.size(); ++i)
+      {
+        if (i > 0)
+        {
+          stream << ',';
+        }
+        writeCoordinate(stream, ring.at(isReversed ? ring.size() - 1 - i : i));
+      }
+      stream << ']';
+    }
+
+    // Writes the coordinates of a GeoJSON MultiPolygon, one polygon per exterior ring followed by the holes
+    // inside it. Esri exterior rings are clockwise and holes counter-clockwise, RFC 7946 expects the opposite.
+    void writePolygons(QTextStream& stream, const Multipart& polygon)
+    {
+      const auto parts = polygon.parts();
+      QList<QList<Point>> exteriors;
+      QList<QList<Point>> holes;
+      for (qsizetype i = 0; i < parts.size(); ++i)
+      {
+        auto ring = ringPoints(parts.part(i));
+        if (ring.size() < 4)
+        {
+          continue;
+        }
+        (signedArea(ring) > 0.0 ? holes : exteriors).append(std::move(ring));
+      }
+
+      if (exteriors.isEmpty())
+      {
+        // not simplified, so every ring is taken to be an exterior ring
+        std::swap(exteriors, holes);
+      }
+
+      // each hole belongs to the first exterior ring containing it
+      QList<QList<qsizetype>> holesOfExterior(exteriors.size());
+      for (qsizetype i = 0; i < holes.size(); ++i)
+      {
+        const auto& vertex = holes.at(i).first();
+        const auto it = std::find_if(exteriors.cbegin(), exteriors.cend(), [&vertex](const QList<Point>& exterior)
+        {
+          return ringContains(exterior, vertex);
+        });
+        holesOfExterior[it != exteriors.cend() ? std::distance(exteriors.cbegin(), it) : 0].append(i);
+      }
+
+      stream << '[';
+      for (qsizetype i = 0; i < exteriors.size(); ++i)
+      {
+        if (i > 0)
+        {
+          stream << ',';
+        }
+        stream << '[';
+        writeRing(stream, exteriors.at(i), true);
+        for (const auto hole : std::as_const(holesOfExterior.at(i)))
+        {
+          stream << ',';
+          writeRing(stream, holes.at(hole), false);
+        }
+        stream << ']';
+      }
+      stream << ']';
+    }
+
+    // Writes the start of a GeoJSON geometry object of type, up to its coordinates.
+    void beginGeoJsonGeometry(QTextStream& stream, QLatin1String type, QLatin1String quote)
+    {
+      stream << '{' << quote << "type" << quote << ':' << quote << type << quote << ',' << quote << "coordinates" << quote << ':';
+    }
+
+    // Writes geometry as a GeoJSON geometry object in WGS84, vertex by vertex, without building a JSON document.
+    // Its quotes are written as quote, so it can be streamed into a quoted CSV field as well.
+    void writeGeoJsonGeometry(QTextStream& stream, const Geometry& geometry, QLatin1String quote = QLatin1String("\""))
+    {
+      if (geometry.isEmpty())
+      {
+        stream << "null";
+        return;
+      }
+
+      const auto wgs84 = SpatialReference::wgs84();
+      const auto projected = geometry.spatialReference() == wgs84 ? geometry : GeometryEngine::project(geometry, wgs84);
+
+      switch (projected.geometryType())
+      {
+        case GeometryType::Point:
+        {
+          beginGeoJsonGeometry(stream, QLatin1String("Point"), quote);
+          writeCoordinate(stream, geometry_cast<Point>(projected));
+          stream << '}';
+          return;
+        }
+        case GeometryType::Multipoint:
+        {
+          const auto points = geometry_cast<Multipoint>(projected).points();
+          beginGeoJsonGeometry(stream, QLatin1String("MultiPoint"), quote);
+          stream << '[';
+          for (qsizetype i = 0; i < points.size(); ++i)
+          {
+            if (i > 0)
+            {
+              stream << ',';
+            }
+            writeCoordinate(stream, points.point(i));
+          }
+          stream << "]}";
+          return;
+        }
+        case GeometryType::Polyline:
+        {
+          beginGeoJsonGeometry(stream, QLatin1String("MultiLineString"), quote);
+          writeParts(stream, geometry_cast<Multipart>(projected));
+          stream << '}';
+          return;
+        }
+        case GeometryType::Polygon:
+        {
+          beginGeoJsonGeometry(stream, QLatin1String("MultiPolygon"), quote);
+          writePolygons(stream, geometry_cast<Multipart>(projected));
+          stream << '}';
+          return;
+        }
+        default:
+        {
+          stream << "null";
+          return;
+        }
+      }
+    }
+
+    QString geometryTypeName(const Geometry& geometry)
+    {
+      switch (geometry.geometryType())
+      {
+        case GeometryType::Multipoint:
+          return QStringLiteral("multipoint");
+        case GeometryType::Polyline:
+          return QStringLiteral("polyline");
+        case GeometryType::Polygon:
+          return QStringLiteral("polygon");
+        default:
+          return QStringLiteral("geometry");
+      }
+    }
+
+    QJsonObject elementProperties(UtilityElement* element)
+    {
+      const auto terminal = element->terminal();
+      QJsonObject properties;
+      properties.insert(QStringLiteral("resultType"), QStringLiteral("element"));
+      properties.insert(QStringLiteral("globalId"), element->globalId().toString(QUuid::WithoutBraces));
+      properties.insert(QStringLiteral("objectId"), element->objectId());
+      properties.insert(QStringLiteral("networkSource"), element->networkSource()->name());
+      properties.insert(QStringLiteral("assetGroup"), element->assetGroup()->name());
+      properties.insert(QStringLiteral("assetType"), element->assetType()->name());
+      properties.insert(QStringLiteral("terminal"), terminal ? terminal->name() : QString{});
+      return properties;
+    }
+  } // namespace
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::UtilityNetworkTraceResultExporter
+    \brief Writes a completed trace result to a GeoJSON or CSV file.
+
+    Rows are written to the file as they are produced. Element results are
+    processed in chunks, each chunk returning to the event loop before the next
+    so the UI stays responsive, and features resolved for an element chunk are
+    released as soon as that chunk has been written.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  UtilityNetworkTraceResultExporter::UtilityNetworkTraceResultExporter(UtilityNetwork* utilityNetwork,
+                                                                       UtilityNetworkTraceResultCache::EntryPointer traceResult,
+                                                                       QObject* parent) :
+    QObject(parent),
+    m_utilityNetwork(utilityNetwork),
+    m_traceResult(std::move(traceResult))
+  {
+  }
+
+  UtilityNetworkTraceResultExporter::~UtilityNetworkTraceResultExporter() = default;
+
+  /*!
+    \brief Opens \a filePath and starts writing the trace result to it in \a format.
+
+    Returns \c false if the file could not be opened, \l finished is emitted otherwise.
+   */
+  bool UtilityNetworkTraceResultExporter::start(const QString& filePath, Format format, int chunkSize)
+  {
+    if (!m_traceResult)
+    {
+      m_errorMessage = tr("There is no trace result to export.");
+      return false;
+    }
+
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+      m_errorMessage = m_file.errorString();
+      return false;
+    }
+
+    m_format = format;
+    m_chunkSize = qMax(1, chunkSize);
+    m_nextElementIndex = 0;
+    m_stream.setDevice(&m_file);
+
+    if (m_format == Format::Csv)
+    {
+      m_stream << csvHeader << '\n';
+    }
+    else
+    {
+      m_stream << "{\"type\":\"FeatureCollection\",\"features\":[";
+    }
+
+    writeFunctionResults();
+    writeGeometryResults();
+    m_stream.flush();
+
+    QTimer::singleShot(0, this, &UtilityNetworkTraceResultExporter::writeNextElementChunk);
+    return true;
+  }
+
+  /*!
+    \brief Stops writing, the partially written file is removed.
+   */
+  void UtilityNetworkTraceResultExporter::cancel()
+  {
+    if (m_isFinished)
+    {
+      return;
+    }
+
+    m_stream.setDevice(nullptr);
+    m_file.remove();
+    finish(false, tr("Export canceled."));
+  }
+
+  QString UtilityNetworkTraceResultExporter::errorMessage() const
+  {
+    return m_errorMessage;
+  }
+
+  void UtilityNetworkTraceResultExporter::writeFunctionResults()
+  {
+    for (const auto& functionResult : m_traceResult->functionResults)
+    {
+      if (m_format == Format::Csv)
+      {
+        m_stream << "function," << csvField(functionResult.name()) << ",,,,,,,"
+                 << QString::number(functionResult.value(), 'g', 17) << ",\n";
+        continue;
+      }
+
+      QJsonObject properties;
+      properties.insert(QStringLiteral("resultType"), QStringLiteral("function"));
+      properties.insert(QStringLiteral("name"), functionResult.name());
+      properties.insert(QStringLiteral("functionType"), functionResult.typeAsLabel());
+      properties.insert(QStringLiteral("value"), functionResult.value());
+
+      beginGeoJsonFeature();
+      m_stream << "\"geometry\":null,\"properties\":" << QJsonDocument(properties).toJson(QJsonDocument::Compact) << '}';
+    }
+  }
+
+  void UtilityNetworkTraceResultExporter::writeGeometryResults()
+  {
+    for (const auto& geometry : m_traceResult->geometries)
+    {
+      if (m_format == Format::Csv)
+      {
+        // streamed as a quoted field, with its quotes doubled, rather than copied into a JSON string first
+        m_stream << "geometry," << geometryTypeName(geometry) << ",,,,,,,,\"";
+        writeGeoJsonGeometry(m_stream, geometry, QLatin1String("\"\""));
+        m_stream << "\"\n";
+        continue;
+      }
+
+      beginGeoJsonFeature();
+      m_stream << "\"geometry\":";
+      writeGeoJsonGeometry(m_stream, geometry);
+      m_stream << ",\"properties\":{\"resultType\":\"geometry\",\"name\":\"" << geometryTypeName(geometry) << "\"}}";
+    }
+  }
+
+  void UtilityNetworkTraceResultExporter::writeNextElementChunk()
+  {
+    if (m_isFinished)
+    {
+      return;
+    }
+
+    const auto& elements = m_traceResult->elements;
+    if (m_nextElementIndex >= elements.size())
+    {
+      if (m_format == Format::GeoJson)
+      {
+        m_stream << "]}\n";
+      }
+      m_stream.flush();
+      m_file.close();
+      finish(m_file.error() == QFileDevice::NoError, m_file.errorString());
+      return;
+    }
+
+    const auto chunk = elements.mid(m_nextElementIndex, m_chunkSize);
+    m_nextElementIndex += chunk.size();
+
+    // CSV rows only describe the element, only GeoJSON needs each element's feature for its geometry and layer
+    if (m_format == Format::Csv || !m_utilityNetwork)
+    {
+      writeElements(chunk, {});
+      return;
+    }
+
+    m_utilityNetwork->featuresForElementsAsync(chunk, this)
+      .then(this,
+            [this, chunk](const QList<ArcGISFeature*>& features)
+    {
+      if (m_isFinished)
+      {
+        qDeleteAll(features);
+        return;
+      }
+      writeElements(chunk, features);
+      qDeleteAll(features);
+    })
+      .onFailed(this, [this, chunk](const ErrorException& e)
+    {
+      qDebug() << "Resolving features for export failed" << e.error().message() << "||" << e.error().additionalMessage();
+      if (!m_isFinished)
+      {
+        writeElements(chunk, {});
+      }
+    });
+  }
+
+  void UtilityNetworkTraceResultExporter::writeElements(const QList<UtilityElement*>& elements, const QList<ArcGISFeature*>& features)
+  {
+    QHash<QUuid, ArcGISFeature*> featuresByGlobalId;
+    featuresByGlobalId.reserve(features.size());
+    for (auto* feature : features)
+    {
+      auto table = static_cast<ArcGISFeatureTable*>(feature->featureTable());
+      featuresByGlobalId.insert(feature->attributes()->attributeValue(table->globalIdField()).toUuid(), feature);
+    }
+
+    for (auto* element : elements)
+    {
+      if (m_format == Format::Csv)
+      {
+        const auto terminal = element->terminal();
+        const auto sourceName = element->networkSource()->name();
+        // the network source is the layer the element belongs to, named as in the utility network definition
+        m_stream << "element," << element->objectId() << ','
+                 << element->globalId().toString(QUuid::WithoutBraces) << ','
+                 << csvField(sourceName) << ','
+                 << csvField(element->assetGroup()->name()) << ','
+                 << csvField(element->assetType()->name()) << ','
+                 << csvField(terminal ? terminal->name() : QString{}) << ','
+                 << csvField(sourceName) << ",,\n";
+        continue;
+      }
+
+      auto properties = elementProperties(element);
+      auto* feature = featuresByGlobalId.value(element->globalId());
+      auto* layer = feature ? feature->featureTable()->layer() : nullptr;
+      properties.insert(QStringLiteral("layer"), layer ? layer->name() : element->networkSource()->name());
+
+      beginGeoJsonFeature();
+      m_stream << "\"geometry\":";
+      writeGeoJsonGeometry(m_stream, feature ? feature->geometry() : Geometry{});
+      m_stream << ",\"properties\":" << QJsonDocument(properties).toJson(QJsonDocument::Compact) << '}';
+    }
+
+    m_stream.flush();
+
+    const auto total = m_traceResult->elements.size();
+    emit progressChanged(total > 0 ? static_cast<double>(m_nextElementIndex) / total : 1.0);
+
+    QTimer::singleShot(0, this, &UtilityNetworkTraceResultExporter::writeNextElementChunk);
+  }
+
+  void UtilityNetworkTraceResultExporter::beginGeoJsonFeature()
+  {
+    if (!m_isFirstGeoJsonFeature)
+    {
+      m_stream << ',';
+    }
+    m_isFirstGeoJsonFeature = false;
+    m_stream << "\n{\"type\":\"Feature\",";
+  }
+
+  void UtilityNetworkTraceResultExporter::finish(bool success, const QString& errorMessage)
+  {
+    m_isFinished = true;
+    m_errorMessage = success ? QString{} : errorMessage;
+    emit finished(success, m_errorMessage);
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
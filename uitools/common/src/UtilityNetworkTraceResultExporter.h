@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERESULTEXPORTER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERESULTEXPORTER_H
+
+// Qt headers
+#include <QFile>
+#include <QObject>
+#include <QTextStream>
+
+// Other headers
+#include "UtilityNetworkTraceResultCache.h"
+
+namespace Esri::ArcGISRuntime
+{
+  class ArcGISFeature;
+  class UtilityNetwork;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class UtilityNetworkTraceResultExporter : public QObject
+  {
+    Q_OBJECT
+
+  public:
+    enum class Format
+    {
+      GeoJson,
+      Csv
+    };
+
+    UtilityNetworkTraceResultExporter(UtilityNetwork* utilityNetwork,
+                                      UtilityNetworkTraceResultCache::EntryPointer traceResult,
+                                      QObject* parent = nullptr);
+    ~UtilityNetworkTraceResultExporter() override;
+
+    bool start(const QString& filePath, Format format, int chunkSize);
+
+    void cancel();
+
+    QString errorMessage() const;
+
+  signals:
+    void progressChanged(double progress);
+    void finished(bool success, const QString& errorMessage);
+
+  private:
+    void writeFunctionResults();
+    void writeGeometryResults();
+    void writeNextElementChunk();
+    void writeElements(const QList<UtilityElement*>& elements, const QList<ArcGISFeature*>& features);
+    void beginGeoJsonFeature();
+    void finish(bool success, const QString& errorMessage);
+
+    UtilityNetwork* m_utilityNetwork = nullptr;
+    UtilityNetworkTraceResultCache::EntryPointer m_traceResult;
+    Format m_format = Format::GeoJson;
+    int m_chunkSize = 1000;
+    qsizetype m_nextElementIndex = 0;
+    bool m_isFirstGeoJsonFeature = true;
+    bool m_isFinished = false;
+    QFile m_file;
+    QTextStream m_stream;
+    QString m_errorMessage;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERESULTEXPORTER_H
@@ -0,0 +1,255 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "UtilityNetworkTraceRun.h"
+
+// ArcGISRuntime headers
+#include <Error.h>
+#include <ErrorException.h>
+#include <Graphic.h>
+#include <GraphicListModel.h>
+#include <GraphicsOverlay.h>
+#include <Multipoint.h>
+#include <Polygon.h>
+#include <Polyline.h>
+#include <SimpleFillSymbol.h>
+#include <SimpleLineSymbol.h>
+#include <SimpleMarkerSymbol.h>
+#include <SymbolTypes.h>
+#include <UtilityElementTraceResult.h>
+#include <UtilityFunctionTraceResult.h>
+#include <UtilityGeometryTraceResult.h>
+#include <UtilityNamedTraceConfiguration.h>
+#include <UtilityNetwork.h>
+#include <UtilityNetworkAttribute.h>
+#include <UtilityTraceFunction.h>
+#include <UtilityTraceFunctionOutput.h>
+#include <UtilityTraceParameters.h>
+#include <UtilityTraceResult.h>
+
+// Toolkit headers
+#include "UtilityNetworkFunctionTraceResult.h"
+#include "UtilityNetworkFunctionTraceResultsModel.h"
+
+// Qt headers
+#include <QFuture>
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  /*!
+    \internal
+    \class Esri::ArcGISRuntime::Toolkit::UtilityNetworkTraceRun
+    \brief One of several named trace configurations run side by side from the same starting points.
+
+    Each run owns the graphics overlay its geometry results are drawn into, and the
+    model of its function results.
+
+    This class is an internal implementation detail and is subject to change.
+   */
+
+  UtilityNetworkTraceRun::UtilityNetworkTraceRun(QObject* parent) :
+    UtilityNetworkTraceRun(nullptr, QColor(0, 0, 255), parent)
+  {
+  }
+
+  UtilityNetworkTraceRun::UtilityNetworkTraceRun(UtilityNamedTraceConfiguration* traceConfiguration, const QColor& color, QObject* parent) :
+    QObject(parent),
+    m_traceConfiguration(traceConfiguration),
+    m_color(color),
+    m_graphicsOverlay(new GraphicsOverlay(this)),
+    m_functionResults(new UtilityNetworkFunctionTraceResultsModel(this))
+  {
+    QColor translucent = m_color;
+    translucent.setAlpha(126);
+    m_pointSymbol = new SimpleMarkerSymbol(SimpleMarkerSymbolStyle::Circle, translucent, 20, this);
+    m_lineSymbol = new SimpleLineSymbol(SimpleLineSymbolStyle::Dot, translucent, 5, this);
+    m_fillSymbol = new SimpleFillSymbol(SimpleFillSymbolStyle::ForwardDiagonal, translucent,
+                                        new SimpleLineSymbol(SimpleLineSymbolStyle::Solid, translucent, 2, this), this);
+  }
+
+  UtilityNetworkTraceRun::~UtilityNetworkTraceRun() = default;
+
+  /*!
+    \brief Starts tracing from \a startingPoints on \a utilityNetwork.
+
+    Several runs may be started at once, their traces are processed concurrently by the service.
+   */
+  void UtilityNetworkTraceRun::start(UtilityNetwork* utilityNetwork, const QList<UtilityElement*>& startingPoints)
+  {
+    if (m_isTraceInProgress || !utilityNetwork || !m_traceConfiguration)
+    {
+      return;
+    }
+
+    setIsTraceInProgress(true);
+
+    auto parameters = new UtilityTraceParameters(m_traceConfiguration, startingPoints, this);
+
+    // the results are handed to the continuation directly, so concurrent runs cannot clobber each other
+    utilityNetwork->traceAsync(parameters, this)
+      .then(this,
+            [this, parameters](const QList<UtilityTraceResult*>& results)
+    {
+      delete parameters;
+      onTraceCompleted(results);
+    })
+      .onFailed(this, [this, parameters](const ErrorException& e)
+    {
+      delete parameters;
+      qDebug() << "Trace" << name() << "failed" << e.error().message() << "||" << e.error().additionalMessage();
+      m_errorMessage = e.error().message();
+      emit errorMessageChanged();
+      setIsTraceInProgress(false);
+      emit traceCompleted();
+    });
+  }
+
+  UtilityNamedTraceConfiguration* UtilityNetworkTraceRun::traceConfiguration() const
+  {
+    return m_traceConfiguration;
+  }
+
+  QString UtilityNetworkTraceRun::name() const
+  {
+    return m_traceConfiguration ? m_traceConfiguration->name() : QString{};
+  }
+
+  QColor UtilityNetworkTraceRun::color() const
+  {
+    return m_color;
+  }
+
+  bool UtilityNetworkTraceRun::isTraceInProgress() const
+  {
+    return m_isTraceInProgress;
+  }
+
+  void UtilityNetworkTraceRun::setIsTraceInProgress(bool isTraceInProgress)
+  {
+    if (m_isTraceInProgress == isTraceInProgress)
+    {
+      return;
+    }
+
+    m_isTraceInProgress = isTraceInProgress;
+    emit isTraceInProgressChanged();
+  }
+
+  bool UtilityNetworkTraceRun::isVisible() const
+  {
+    return m_graphicsOverlay->isVisible();
+  }
+
+  void UtilityNetworkTraceRun::setVisible(bool visible)
+  {
+    if (m_graphicsOverlay->isVisible() == visible)
+    {
+      return;
+    }
+
+    m_graphicsOverlay->setVisible(visible);
+    emit visibleChanged();
+  }
+
+  int UtilityNetworkTraceRun::elementResultCount() const
+  {
+    return static_cast<int>(m_elements.size());
+  }
+
+  /*!
+    \brief Returns the elements found by this run.
+
+    These are owned by the trace result and stay valid for as long as this run exists.
+   */
+  QList<UtilityElement*> UtilityNetworkTraceRun::elements() const
+  {
+    return m_elements;
+  }
+
+  QString UtilityNetworkTraceRun::errorMessage() const
+  {
+    return m_errorMessage;
+  }
+
+  QAbstractItemModel* UtilityNetworkTraceRun::functionResults() const
+  {
+    return m_functionResults;
+  }
+
+  GraphicsOverlay* UtilityNetworkTraceRun::graphicsOverlay() const
+  {
+    return m_graphicsOverlay;
+  }
+
+  void UtilityNetworkTraceRun::onTraceCompleted(const QList<UtilityTraceResult*>& results)
+  {
+    for (auto* result : results)
+    {
+      switch (result->traceResultObjectType())
+      {
+        case UtilityTraceResultObjectType::UtilityElementTraceResult:
+        {
+          m_elements.append(static_cast<UtilityElementTraceResult*>(result)->elements());
+          break;
+        }
+        case UtilityTraceResultObjectType::UtilityFunctionTraceResult:
+        {
+          const auto outputList = static_cast<UtilityFunctionTraceResult*>(result)->functionOutputs();
+          for (const auto o : outputList)
+          {
+            const auto function = o->function();
+            m_functionResults->addFunctionResult(UtilityNetworkFunctionTraceResult(function->functionName(), function->networkAttribute()->name(),
+                                                                                   function->functionType(), o->result().toDouble()));
+          }
+          break;
+        }
+        case UtilityTraceResultObjectType::UtilityGeometryTraceResult:
+        {
+          auto geometryTraceResult = static_cast<UtilityGeometryTraceResult*>(result);
+
+          auto multipoint = geometryTraceResult->multipoint();
+          if (!multipoint.isEmpty())
+          {
+            m_graphicsOverlay->graphics()->append(new Graphic(multipoint, m_pointSymbol, this));
+          }
+
+          auto polyline = geometryTraceResult->polyline();
+          if (!polyline.isEmpty())
+          {
+            m_graphicsOverlay->graphics()->append(new Graphic(polyline, m_lineSymbol, this));
+          }
+
+          auto polygon = geometryTraceResult->polygon();
+          if (!polygon.isEmpty())
+          {
+            m_graphicsOverlay->graphics()->append(new Graphic(polygon, m_fillSymbol, this));
+          }
+          break;
+        }
+        default:
+        {
+          qDebug() << "Trace completed without usable object type";
+          break;
+        }
+      }
+    }
+
+    emit elementResultCountChanged();
+    setIsTraceInProgress(false);
+    emit traceCompleted();
+  }
+
+} // namespace Esri::ArcGISRuntime::Toolkit
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ *  Copyright 2012-2025 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERUN_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERUN_H
+
+// Qt headers
+#include <QAbstractItemModel>
+#include <QColor>
+#include <QObject>
+
+namespace Esri::ArcGISRuntime
+{
+  class GraphicsOverlay;
+  class SimpleFillSymbol;
+  class SimpleLineSymbol;
+  class SimpleMarkerSymbol;
+  class UtilityElement;
+  class UtilityNamedTraceConfiguration;
+  class UtilityNetwork;
+  class UtilityTraceResult;
+} // namespace Esri::ArcGISRuntime
+
+namespace Esri::ArcGISRuntime::Toolkit
+{
+
+  class UtilityNetworkFunctionTraceResultsModel;
+
+  class UtilityNetworkTraceRun : public QObject
+  {
+    Q_OBJECT
+    Q_PROPERTY(QString name READ name CONSTANT)
+    Q_PROPERTY(QColor color READ color CONSTANT)
+    Q_PROPERTY(bool isTraceInProgress READ isTraceInProgress NOTIFY isTraceInProgressChanged)
+    Q_PROPERTY(bool visible READ isVisible WRITE setVisible NOTIFY visibleChanged)
+    Q_PROPERTY(int elementResultCount READ elementResultCount NOTIFY elementResultCountChanged)
+    Q_PROPERTY(QString errorMessage READ errorMessage NOTIFY errorMessageChanged)
+    Q_PROPERTY(QAbstractItemModel* functionResults READ functionResults CONSTANT)
+
+  public:
+    Q_INVOKABLE explicit UtilityNetworkTraceRun(QObject* parent = nullptr);
+    UtilityNetworkTraceRun(UtilityNamedTraceConfiguration* traceConfiguration, const QColor& color, QObject* parent = nullptr);
+    ~UtilityNetworkTraceRun() override;
+
+    void start(UtilityNetwork* utilityNetwork, const QList<UtilityElement*>& startingPoints);
+
+    UtilityNamedTraceConfiguration* traceConfiguration() const;
+
+    QString name() const;
+
+    QColor color() const;
+
+    bool isTraceInProgress() const;
+
+    bool isVisible() const;
+    void setVisible(bool visible);
+
+    int elementResultCount() const;
+
+    QList<UtilityElement*> elements() const;
+
+    QString errorMessage() const;
+
+    QAbstractItemModel* functionResults() const;
+
+    GraphicsOverlay* graphicsOverlay() const;
+
+  signals:
+    void isTraceInProgressChanged();
+    void visibleChanged();
+    void elementResultCountChanged();
+    void errorMessageChanged();
+    void traceCompleted();
+
+  private:
+    void onTraceCompleted(const QList<UtilityTraceResult*>& results);
+    void setIsTraceInProgress(bool isTraceInProgress);
+
+    UtilityNamedTraceConfiguration* m_traceConfiguration = nullptr;
+    QColor m_color;
+    GraphicsOverlay* m_graphicsOverlay = nullptr;
+    UtilityNetworkFunctionTraceResultsModel* m_functionResults = nullptr;
+    SimpleMarkerSymbol* m_pointSymbol = nullptr;
+    SimpleLineSymbol* m_lineSymbol = nullptr;
+    SimpleFillSymbol* m_fillSymbol = nullptr;
+    QList<UtilityElement*> m_elements;
+    QString m_errorMessage;
+    bool m_isTraceInProgress = false;
+  };
+
+} // namespace Esri::ArcGISRuntime::Toolkit
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_UTILITYNETWORKTRACERUN_H
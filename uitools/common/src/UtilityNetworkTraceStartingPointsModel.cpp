@@ -19,6 +19,10 @@
 #include "UtilityNetworkTraceStartingPoint.h"
 
 #include <UtilityElement.h>
+#include <UtilityNetworkSource.h>
+#include <UtilityTerminal.h>
+
+#include <QUuid>
 
 namespace Esri::ArcGISRuntime::Toolkit
 {
@@ -128,6 +132,27 @@ namespace Esri::ArcGISRuntime::Toolkit
     beginInsertRows(QModelIndex(), count, count);
 
     m_data.push_back(startingPoint);
+    m_elementKeys.insert(elementKey(startingPoint->utilityElement()));
+
+    endInsertRows();
+  }
+
+  void UtilityNetworkTraceStartingPointsModel::addStartingPoints(const QList<UtilityNetworkTraceStartingPoint*>& startingPoints)
+  {
+    if (startingPoints.isEmpty())
+    {
+      return;
+    }
+
+    // a single insertion keeps views from relaying out once per starting point
+    const int count = static_cast<int>(m_data.size());
+    beginInsertRows(QModelIndex(), count, count + static_cast<int>(startingPoints.size()) - 1);
+
+    m_data.append(startingPoints);
+    for (const auto startingPoint : startingPoints)
+    {
+      m_elementKeys.insert(elementKey(startingPoint->utilityElement()));
+    }
 
     endInsertRows();
   }
@@ -147,25 +172,19 @@ namespace Esri::ArcGISRuntime::Toolkit
   {
     beginResetModel();
     m_data.clear();
+    m_elementKeys.clear();
     endResetModel();
   }
 
   bool UtilityNetworkTraceStartingPointsModel::doesItemAlreadyExist(UtilityElement* utilityElement) const
   {
-    auto utilityElementId = utilityElement->objectId();
-    for (const auto& startingPoint : m_data)
-    {
-      if (startingPoint->utilityElement()->objectId() == utilityElementId)
-      {
-        return true;
-      }
-    }
-    return false;
+    return m_elementKeys.contains(elementKey(utilityElement));
   }
 
   void UtilityNetworkTraceStartingPointsModel::removeAt(int index)
   {
     beginRemoveRows(QModelIndex(), index, index);
+    m_elementKeys.remove(elementKey(m_data.at(index)->utilityElement()));
     m_data.remove(index);
     endRemoveRows();
   }
@@ -180,6 +199,20 @@ namespace Esri::ArcGISRuntime::Toolkit
     return m_data.size();
   }
 
+  /*!
+    \brief Returns the key identifying \a utilityElement as a starting point.
+
+    Two elements with the same network source, global id and terminal are the same starting point.
+   */
+  QString UtilityNetworkTraceStartingPointsModel::elementKey(UtilityElement* utilityElement)
+  {
+    const auto terminal = utilityElement->terminal();
+    return QStringLiteral("%1:%2:%3")
+      .arg(utilityElement->networkSource()->sourceId())
+      .arg(utilityElement->globalId().toString(QUuid::WithoutBraces))
+      .arg(terminal ? terminal->terminalId() : -1);
+  }
+
   QHash<int, QByteArray> UtilityNetworkTraceStartingPointsModel::roleNames() const
   {
     return m_roles;
@@ -19,6 +19,7 @@
 
 // Qt headers
 #include <QAbstractListModel>
+#include <QSet>
 
 // STL headers
 #include <Point.h>
@@ -59,6 +60,8 @@ namespace Esri::ArcGISRuntime
 
       void addStartingPoint(UtilityNetworkTraceStartingPoint* startingPoint);
 
+      void addStartingPoints(const QList<UtilityNetworkTraceStartingPoint*>& startingPoints);
+
       QList<UtilityElement*> utilityElements() const;
 
       void clear();
@@ -71,6 +74,8 @@ namespace Esri::ArcGISRuntime
 
       int size() const;
 
+      static QString elementKey(UtilityElement* utilityElement);
+
     private:
       QHash<int, QByteArray> roleNames() const override;
 
@@ -78,6 +83,8 @@ namespace Esri::ArcGISRuntime
 
       QHash<int, QByteArray> m_roles;
       QList<UtilityNetworkTraceStartingPoint*> m_data;
+      // keys of the utility elements in m_data, see elementKey()
+      QSet<QString> m_elementKeys;
     };
   } // namespace Toolkit
 } // namespace Esri::ArcGISRuntime
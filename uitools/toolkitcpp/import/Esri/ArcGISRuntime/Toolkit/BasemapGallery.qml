@@ -84,6 +84,19 @@ Pane {
         }
     }
 
+    // the default basemaps are only fetched once the gallery is first shown
+    onVisibleChanged: {
+        if (visible && controller) {
+            controller.fetchBasemaps();
+        }
+    }
+
+    Component.onCompleted: {
+        if (visible && controller) {
+            controller.fetchBasemaps();
+        }
+    }
+
     /*!
        \qmlproperty GenericListModel gallery
         The list of basemaps currently visible in the gallery. Items added or removed from this
@@ -199,13 +212,37 @@ Pane {
         currentIndex: controller.basemapIndex(controller.currentBasemap)
         ScrollBar.vertical: ScrollBar { id: scrollBar }
 
+        // Only the basemaps in and around the visible rows are loaded.
+        function updateVisibleRange() {
+            if (count === 0 || width <= 0 || height <= 0)
+                return;
+            let first = indexAt(contentX + 1, contentY + 1);
+            let last = indexAt(contentX + width - 1, contentY + height - 1);
+            if (last === -1) {
+                // the last row is not full or the view is taller than its content
+                last = count - 1;
+            }
+            controller.setVisibleRange(Math.max(first, 0), last);
+        }
+
+        onContentYChanged: updateVisibleRange()
+        onHeightChanged: updateVisibleRange()
+        onWidthChanged: updateVisibleRange()
+        onCountChanged: updateVisibleRange()
+
         delegate: ItemDelegate {
             id: basemapDelegate
             property bool isGrid: basemapGallery.internal.calculatedStyle === BasemapGallery.ViewStyle.Grid
             width: view.cellWidth
             height: view.cellHeight
-            enabled: controller.basemapMatchesCurrentSpatialReference(listModelData.basemap)
+            // refreshed by the controller whenever the compatibility of the basemap changes
+            enabled: itemEnabled
             onClicked: controller.setCurrentBasemap(listModelData.basemap)
+            // the base layer starts loading before the basemap is picked
+            onActiveFocusChanged: {
+                if (activeFocus)
+                    controller.prewarmBasemap(listModelData.basemap);
+            }
             indicator: Item { }
             down: GridView.isCurrentItem
 
@@ -335,6 +372,7 @@ Pane {
 
                 // When mouse enters thumbnail area, use timer to delay showing of tooltip.
                 onEntered: {
+                    controller.prewarmBasemap(listModelData.basemap);
                     // Create a definition for the showTooltipFn property of timerOnEntered
                     timerOnEntered.showTooltipFn = () => {
                         if (allowTooltips && mouseArea.containsMouse && listModelData.tooltip !== "")
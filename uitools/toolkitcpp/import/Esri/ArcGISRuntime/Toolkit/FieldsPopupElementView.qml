@@ -31,7 +31,7 @@ ListView {
 
     height: contentHeight
     interactive: false
-    model: controller ? controller.labelsAndValues : null
+    model: controller ? controller.fields : null
     clip: true
     focus: true
     spacing: 10
@@ -54,7 +54,7 @@ ListView {
             rightPadding: 10
         }
         Label {
-            text: model.modelData["label"]
+            text: model.label
             wrapMode: Text.WordWrap
             width: parent.width
             font.weight: Font.Bold
@@ -62,21 +62,17 @@ ListView {
             leftPadding: 20
         }
         Label {
-            text: model.modelData["formattedValue"]
+            // Checks to see if the formatted value is a hyperlink.
+            // If it is, it will modify the text to be a clickable link
+            // displayed as `View`. This is a binding, as delegates are kept
+            // when the value of their field changes.
+            readonly property bool isLink: model.formattedValue.toLowerCase().startsWith("http")
+            text: isLink ? popupView.changeHyperlinkColor(`<a href="${model.formattedValue}">View</a>`) : model.formattedValue
+            textFormat: isLink ? Text.RichText : Text.AutoText
             wrapMode: Text.WordWrap
             width: parent.width
             rightPadding: 10
             leftPadding: 20
-            Component.onCompleted: {
-                // Checks to see if the formatted value is a hyperlink.
-                // If it is, it will modify the text to be a clickable link
-                // displayed as `View`.
-                if (text.toLowerCase().startsWith("http")) {
-                    let link = text;
-                    text = popupView.changeHyperlinkColor(`<a href="${link}">View</a>`);
-                    textFormat = Text.RichText;
-                }
-            }
             onLinkActivated: (link) => {
                 // emit signal to bubble up link to PopupViewController
                 controller.clickedUrl(link);
@@ -316,6 +316,21 @@ ColumnLayout {
                         }
                     }
 
+                    // Live images are only refreshed while they are on screen, in a visible window.
+                    Binding {
+                        target: listModelData
+                        property: "active"
+                        value: popupImage.visible && popupImage.Window.window !== null && popupImage.Window.window.visible
+                               && (fullScreenImageDialog.visible
+                                   || (delegatePopupMedia.x + delegatePopupMedia.width > lv.contentX && delegatePopupMedia.x < lv.contentX + lv.width))
+                        restoreMode: Binding.RestoreNone
+                    }
+
+                    Component.onDestruction: {
+                        if (listModelData)
+                            listModelData.active = false;
+                    }
+
                     Connections {
                         target: listModelData
 
@@ -605,7 +620,7 @@ ColumnLayout {
 
                     axisX: ValueAxis {
                         id: xAxis
-                        max: listModelData.linePoints.length - 1
+                        max: listModelData.pointCount - 1
                         tickInterval: 1
                         labelsVisible: false
                     }
@@ -618,7 +633,8 @@ ColumnLayout {
                     LineSeries {
                         hoverable: isHoverable
                         Component.onCompleted: {
-                            let points = listModelData.linePoints;
+                            // downsampled to the width of the chart, long series add nothing a pixel can show
+                            let points = listModelData.linePointsForWidth(parent.width);
                             if (!listModelData.chartColorsEmpty)
                                 color = listModelData.color;
                             if (points.length > 0)
@@ -51,12 +51,74 @@ Item {
      */
     property real scaleFactor: 25;
 
+    /*!
+      \qmlproperty bool staticInset
+      \brief Whether the OverviewMap is drawn from cached images of its basemap instead of a live map.
+
+      The images are exported from the live map the first time they are needed and cached to disk.
+      From then on only the reticle is drawn as the geoView navigates. Defaults to \c false.
+      \since Esri.ArcGISRuntime 200.8
+     */
+    property bool staticInset: false;
+
+    /*!
+      \internal
+    */
+    property Item staticInsetView: Image {
+        anchors.fill: overviewMap
+        visible: overviewMap.controller.staticInset && source.toString() !== ""
+        source: overviewMap.controller.staticInsetImage
+        asynchronous: true
+
+        Canvas {
+            id: staticInsetReticle
+            anchors.fill: parent
+            onPaint: {
+                const ctx = getContext("2d");
+                ctx.reset();
+                ctx.strokeStyle = "red";
+                ctx.lineWidth = 1;
+                const rings = overviewMap.controller.staticInsetReticle;
+                for (let i = 0; i < rings.length; ++i) {
+                    const ring = rings[i];
+                    ctx.beginPath();
+                    if (ring.length === 1) {
+                        // the center of a scene, drawn as a cross
+                        const x = ring[0].x * width;
+                        const y = ring[0].y * height;
+                        ctx.moveTo(x - 8, y);
+                        ctx.lineTo(x + 8, y);
+                        ctx.moveTo(x, y - 8);
+                        ctx.lineTo(x, y + 8);
+                    } else {
+                        for (let j = 0; j < ring.length; ++j) {
+                            if (j === 0)
+                                ctx.moveTo(ring[j].x * width, ring[j].y * height);
+                            else
+                                ctx.lineTo(ring[j].x * width, ring[j].y * height);
+                        }
+                        ctx.closePath();
+                    }
+                    ctx.stroke();
+                }
+            }
+
+            Connections {
+                target: overviewMap.controller
+                function onStaticInsetReticleChanged() {
+                    staticInsetReticle.requestPaint();
+                }
+            }
+        }
+    }
+
     implicitWidth: 300
 
     implicitHeight: 200
 
     children: [
-        controller.insetView
+        controller.insetView,
+        staticInsetView
     ]
 
     Binding {
@@ -71,6 +133,25 @@ Item {
         value: controller.scaleFactor
     }
 
+    Binding {
+        target: controller
+        property: "staticInset"
+        value: staticInset
+    }
+
+    Binding {
+        target: overviewMap
+        property: "staticInset"
+        value: controller.staticInset
+    }
+
+    Binding {
+        target: controller.insetView
+        property: "visible"
+        // kept beneath the static inset while rasters are exported from it, which needs it drawn
+        value: controller.liveInset
+    }
+
     Binding {
         target: controller
         property: "geoView"
@@ -119,6 +119,24 @@ Page {
      */
     signal attachmentDataFetched(var attachmentData, var name)
 
+    /*!
+       \qmlsignal PopupView::attachmentFileFetched(url localData, string name)
+       \brief Signal emitted instead of \l attachmentDataFetched for attachments larger than \l attachmentDataSizeLimit.
+       The \a localData is the local file the attachment was downloaded to.
+       The \a name of the Popup Attachment is the name of the attachment.
+     */
+    signal attachmentFileFetched(url localData, string name)
+
+    /*!
+       \qmlproperty double attachmentDataSizeLimit
+       \brief The size in bytes above which the data of downloaded attachments is not forwarded, and they are
+       reported through \l attachmentFileFetched with the local file instead of \l attachmentDataFetched.
+       The data is still downloaded into memory in full.
+
+       Defaults to \c{-1}, which reports the data of every attachment.
+     */
+    property double attachmentDataSizeLimit: -1
+
     /*!
        \qmlsignal PopupView::clickedUrl(var url)
        \brief Signal emitted when a url or hyperlink is clicked.
@@ -148,6 +166,12 @@ Page {
         value: popupView.popup
     }
 
+    Binding {
+        target: controller
+        property: "attachmentDataSizeLimit"
+        value: popupView.attachmentDataSizeLimit
+    }
+
     Connections {
         target: controller
 
@@ -155,6 +179,10 @@ Page {
             attachmentDataFetched(attachmentData, name);
         }
 
+        function onAttachmentFileFetched(localData, name) {
+            attachmentFileFetched(localData, name);
+        }
+
         function onClickedUrl(url) {
             clickedUrl(url);
         }
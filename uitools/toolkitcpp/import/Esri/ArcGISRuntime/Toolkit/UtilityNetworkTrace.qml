@@ -287,6 +287,19 @@ Pane {
                     visible: running
                 }
 
+                ProgressBar {
+                    Layout.fillWidth: true
+                    value: controller.elementSelectionProgress
+                    visible: controller.isElementSelectionInProgress
+                }
+
+                Label {
+                    Layout.fillWidth: true
+                    wrapMode: Text.WordWrap
+                    text: qsTr("%1 elements found. Too many to select on the map.").arg(controller.elementResultCount)
+                    visible: controller.isElementResultAboveSelectionLimit
+                }
+
                 ListView {
                     id: functionResultsList
                     anchors.margins: 4
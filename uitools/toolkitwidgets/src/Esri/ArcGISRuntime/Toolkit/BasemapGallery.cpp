@@ -21,6 +21,9 @@
 // Toolkit headers
 #include "BasemapGalleryController.h"
 
+// Qt headers
+#include <QScrollBar>
+
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
@@ -59,6 +62,22 @@ namespace Esri::ArcGISRuntime::Toolkit
     // both are needed for setting the initial basemap or in case a new basemap is loaded by changing the geomodel.
     connect(m_ui->listView->selectionModel(), &QItemSelectionModel::currentChanged, this, &BasemapGallery::onItemSelected);
     connect(m_controller, &BasemapGalleryController::currentBasemapChanged, this, &BasemapGallery::onCurrentBasemapChanged);
+
+    // only the basemaps in and around the visible rows are loaded
+    connect(m_ui->listView->verticalScrollBar(), &QScrollBar::valueChanged, this, &BasemapGallery::updateVisibleRange);
+    connect(m_ui->listView->horizontalScrollBar(), &QScrollBar::valueChanged, this, &BasemapGallery::updateVisibleRange);
+    connect(model, &GenericListModel::rowsInserted, this, &BasemapGallery::updateVisibleRange, Qt::QueuedConnection);
+    connect(model, &GenericListModel::rowsRemoved, this, &BasemapGallery::updateVisibleRange, Qt::QueuedConnection);
+
+    // the base layer of a hovered basemap starts loading before it is picked
+    m_ui->listView->setMouseTracking(true);
+    connect(m_ui->listView, &QAbstractItemView::entered, this, [this](const QModelIndex& index)
+    {
+      if (auto* item = m_controller->gallery()->element<BasemapGalleryItem>(index))
+      {
+        m_controller->prewarmBasemap(item->basemap());
+      }
+    });
   }
 
   /*!
@@ -141,4 +160,51 @@ namespace Esri::ArcGISRuntime::Toolkit
     }
     m_ui->listView->selectionModel()->select(index, QItemSelectionModel::Select);
   }
+
+  /*!
+    \internal
+   */
+  void BasemapGallery::resizeEvent(QResizeEvent* event)
+  {
+    QFrame::resizeEvent(event);
+    updateVisibleRange();
+  }
+
+  /*!
+    \internal
+    \brief The default basemaps are only fetched once the gallery is first shown.
+   */
+  void BasemapGallery::showEvent(QShowEvent* event)
+  {
+    QFrame::showEvent(event);
+    m_controller->fetchBasemaps();
+  }
+
+  /*!
+    \internal
+    \brief Slot that tells the controller which rows of the gallery are on screen.
+   */
+  void BasemapGallery::updateVisibleRange()
+  {
+    auto* model = m_controller->gallery();
+    const auto viewportRect = m_ui->listView->viewport()->rect();
+    int first = -1;
+    int last = -1;
+    for (int row = 0; row < model->rowCount(); ++row)
+    {
+      if (m_ui->listView->visualRect(model->index(row)).intersects(viewportRect))
+      {
+        if (first < 0)
+        {
+          first = row;
+        }
+        last = row;
+      }
+    }
+
+    if (first >= 0)
+    {
+      m_controller->setVisibleRange(first, last);
+    }
+  }
 } // namespace Esri::ArcGISRuntime::Toolkit
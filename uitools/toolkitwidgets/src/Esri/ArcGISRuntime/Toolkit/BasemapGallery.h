@@ -46,9 +46,14 @@ namespace Esri::ArcGISRuntime
       void setGeoModel(GeoModel* geomodel);
       GeoModel* geoModel();
 
+    protected:
+      void resizeEvent(QResizeEvent* event) override;
+      void showEvent(QShowEvent* event) override;
+
     private slots:
       void onItemSelected(const QModelIndex& index);
       void onCurrentBasemapChanged();
+      void updateVisibleRange();
 
     private:
       BasemapGalleryController* m_controller = nullptr;
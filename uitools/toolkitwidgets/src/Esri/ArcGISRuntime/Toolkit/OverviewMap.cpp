@@ -28,10 +28,74 @@
 
 // Qt headers
 #include <QGridLayout>
+#include <QImage>
+#include <QPainter>
+#include <QPen>
+#include <QPointF>
+#include <QPolygonF>
+#include <QUrl>
 
 namespace Esri::ArcGISRuntime::Toolkit
 {
 
+  namespace
+  {
+    // Draws the cached raster of the static inset with the reticle on top.
+    class StaticInsetView : public QWidget
+    {
+    public:
+      StaticInsetView(OverviewMapController* controller, QWidget* parent) :
+        QWidget(parent),
+        m_controller(controller)
+      {
+      }
+
+    protected:
+      void paintEvent(QPaintEvent*) override
+      {
+        const auto imageUrl = m_controller->staticInsetImage();
+        if (imageUrl != m_imageUrl)
+        {
+          m_image.load(imageUrl.toLocalFile());
+          m_imageUrl = imageUrl;
+        }
+
+        QPainter painter(this);
+        painter.drawImage(rect(), m_image);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(QPen(Qt::red, 1.0));
+
+        const auto rings = m_controller->staticInsetReticle();
+        for (const auto& ring : rings)
+        {
+          QPolygonF polygon;
+          for (const auto& point : ring.toList())
+          {
+            const auto normalized = point.toPointF();
+            polygon.append(QPointF(normalized.x() * width(), normalized.y() * height()));
+          }
+
+          if (polygon.size() == 1)
+          {
+            // the center of a scene, drawn as a cross
+            const auto center = polygon.first();
+            painter.drawLine(center - QPointF(8.0, 0.0), center + QPointF(8.0, 0.0));
+            painter.drawLine(center - QPointF(0.0, 8.0), center + QPointF(0.0, 8.0));
+          }
+          else
+          {
+            painter.drawPolygon(polygon);
+          }
+        }
+      }
+
+    private:
+      OverviewMapController* m_controller = nullptr;
+      QUrl m_imageUrl;
+      QImage m_image;
+    };
+  } // namespace
+
   /*!
     \class Esri::ArcGISRuntime::Toolkit::OverviewMap
     \inmodule Esri.ArcGISRuntime.Toolkit
@@ -56,6 +120,23 @@ namespace Esri::ArcGISRuntime::Toolkit
   {
     m_ui->setupUi(this);
     m_ui->gridLayout->addWidget(m_controller->insetView(), 0, 0, 1, 1);
+
+    auto* staticInsetView = new StaticInsetView(m_controller, this);
+    staticInsetView->setVisible(false);
+    m_ui->gridLayout->addWidget(staticInsetView, 0, 0, 1, 1);
+
+    // the static inset is drawn over the live inset, which stays visible beneath it while rasters are
+    // exported from it, as that needs it drawn
+    auto updateStaticInsetView = [this, staticInsetView]
+    {
+      staticInsetView->setVisible(m_controller->isStaticInset() && !m_controller->staticInsetImage().isEmpty());
+      staticInsetView->raise();
+      staticInsetView->update();
+      m_controller->insetView()->setVisible(m_controller->isLiveInset());
+    };
+    connect(m_controller, &OverviewMapController::staticInsetChanged, this, updateStaticInsetView);
+    connect(m_controller, &OverviewMapController::staticInsetReticleChanged, this, updateStaticInsetView);
+    connect(m_controller, &OverviewMapController::liveInsetChanged, this, updateStaticInsetView);
   }
 
   /*!
@@ -97,4 +97,21 @@ void BasemapGalleryItemUnitTest::ctor_Portalitem()
   QVERIFY(!item.tooltip().isNull());
 }
 
+void BasemapGalleryItemUnitTest::setLoadsBasemap_false()
+{
+  PortalItem portalItem(QUrl("https://runtime.maps.arcgis.com/home/item.html?id=46a87c20f09e4fc48fa3c38081e0cae6"));
+  Basemap b(&portalItem);
+  // as created by the gallery controller, which schedules the load itself.
+  BasemapGalleryItem item;
+  item.setLoadsBasemap(false);
+  item.setBasemap(&b);
+  QCOMPARE(item.basemap(), &b);
+  QCOMPARE(b.loadStatus(), LoadStatus::NotLoaded);
+
+  QSignalSpy basemapChanged(&item, &BasemapGalleryItem::basemapChanged);
+  b.load();
+  QVERIFY(basemapChanged.wait());
+  QCOMPARE(item.name(), QString("OpenStreetMap (Blueprint)"));
+}
+
 QTEST_MAIN(BasemapGalleryItemUnitTest)
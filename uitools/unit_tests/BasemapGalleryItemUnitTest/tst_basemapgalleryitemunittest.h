@@ -39,6 +39,7 @@ private slots:
   void ctor_Basemap();
   void ctor_Overrides();
   void ctor_Portalitem();
+  void setLoadsBasemap_false();
 
 private:
   Esri::ArcGISRuntime::Basemap* m_basemapLightGray = nullptr;